@@ -0,0 +1,315 @@
+#include "ColumnFile.h"
+
+#include <filesystem>
+#include <fstream>
+#include <cstring>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    //// File signature and format version, checked by Open
+    constexpr char Magic[8] = { 'D', 'O', 'C', 'O', 'L', 'S', '0', '1' };
+    constexpr uint32_t Version = 1;
+
+    /**
+    * @brief Rounds an offset up to the next column alignment boundary
+    */
+    uint64_t AlignOffset(uint64_t offset)
+    {
+        return (offset + ColumnFile::Alignment - 1) & ~static_cast<uint64_t>(ColumnFile::Alignment - 1);
+    }
+}
+
+/**
+* @brief Construct a Column File object taking over another one's mapping
+* @param other Column file left closed
+*/
+ColumnFile::ColumnFile(ColumnFile&& other) noexcept
+{
+    *this = std::move(other);
+}
+
+/**
+* @brief Closes this file and takes over another one's mapping (spans from other stay valid)
+* @param other Column file left closed
+* @return This column file
+*/
+ColumnFile& ColumnFile::operator=(ColumnFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        Close();
+        mapping = std::exchange(other.mapping, nullptr);
+        mappingSize = std::exchange(other.mappingSize, 0);
+        header = std::exchange(other.header, nullptr);
+        directory = std::exchange(other.directory, nullptr);
+#if defined(_WIN32)
+        fileHandle = std::exchange(other.fileHandle, nullptr);
+        mappingHandle = std::exchange(other.mappingHandle, nullptr);
+#endif
+    }
+    return *this;
+}
+
+/**
+* @brief Destroys the Column File object, unmapping the file
+*/
+ColumnFile::~ColumnFile()
+{
+    Close();
+}
+
+/**
+* @brief Maps a column file (copy-on-write) and validates its header and directory
+* @param path File written by Write
+* @throws std::runtime_error if the file cannot be mapped or is not a valid column file
+*/
+void ColumnFile::Open(const std::string& path)
+{
+    Close();
+
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    LARGE_INTEGER fileSize = {};
+    if (file == INVALID_HANDLE_VALUE || !GetFileSizeEx(file, &fileSize))
+    {
+        if (file != INVALID_HANDLE_VALUE)
+        {
+            CloseHandle(file);
+        }
+        throw std::runtime_error("ColumnFile: cannot open " + path);
+    }
+    fileHandle = file;
+    mappingSize = static_cast<size_t>(fileSize.QuadPart);
+
+    if (mappingSize != 0)
+    {
+        mappingHandle = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        mapping = mappingHandle ? static_cast<std::byte*>(MapViewOfFile(mappingHandle, FILE_MAP_COPY, 0, 0, 0)) : nullptr;
+    }
+#else
+    const int file = open(path.c_str(), O_RDONLY);
+    struct stat fileStat = {};
+    if (file < 0 || fstat(file, &fileStat) != 0)
+    {
+        if (file >= 0)
+        {
+            close(file);
+        }
+        throw std::runtime_error("ColumnFile: cannot open " + path);
+    }
+    mappingSize = static_cast<size_t>(fileStat.st_size);
+
+    if (mappingSize != 0)
+    {
+        void* view = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0);
+        mapping = view == MAP_FAILED ? nullptr : static_cast<std::byte*>(view);
+    }
+    close(file);
+#endif
+
+    if (mapping == nullptr)
+    {
+        Close();
+        throw std::runtime_error("ColumnFile: cannot map " + path);
+    }
+
+    header = reinterpret_cast<const FileHeader*>(mapping);
+    const bool validHeader = mappingSize >= sizeof(FileHeader) && std::memcmp(header->magic, Magic, sizeof(Magic)) == 0
+                             && header->version == Version && header->directoryOffset % alignof(ColumnEntry) == 0
+                             && header->directoryOffset <= mappingSize
+                             && header->columnCount <= (mappingSize - header->directoryOffset) / sizeof(ColumnEntry);
+    if (!validHeader)
+    {
+        Close();
+        throw std::runtime_error("ColumnFile: " + path + " is not a column file (or has another version)");
+    }
+
+    directory = reinterpret_cast<const ColumnEntry*>(mapping + header->directoryOffset);
+    for (uint32_t column = 0; column < header->columnCount; column++)
+    {
+        const ColumnEntry& entry = directory[column];
+        const bool validEntry = entry.name[MaxNameLength] == '\0' && entry.offset % Alignment == 0
+                                && entry.offset <= mappingSize && entry.size <= mappingSize - entry.offset;
+        if (!validEntry)
+        {
+            Close();
+            throw std::runtime_error("ColumnFile: " + path + " has a corrupted column directory");
+        }
+    }
+}
+
+/**
+* @brief Unmaps the file; spans returned by GetColumn become invalid
+*/
+void ColumnFile::Close()
+{
+#if defined(_WIN32)
+    if (mapping != nullptr)
+    {
+        UnmapViewOfFile(mapping);
+    }
+    if (mappingHandle != nullptr)
+    {
+        CloseHandle(mappingHandle);
+    }
+    if (fileHandle != nullptr)
+    {
+        CloseHandle(fileHandle);
+    }
+    mappingHandle = nullptr;
+    fileHandle = nullptr;
+#else
+    if (mapping != nullptr)
+    {
+        munmap(mapping, mappingSize);
+    }
+#endif
+
+    mapping = nullptr;
+    mappingSize = 0;
+    header = nullptr;
+    directory = nullptr;
+}
+
+/**
+* @brief Checks whether a file is mapped
+* @return true between a successful Open and Close
+*/
+bool ColumnFile::IsOpen() const
+{
+    return mapping != nullptr;
+}
+
+/**
+* @brief Gets the number of rows stored in the header
+* @return Row count, 0 if no file is open
+*/
+uint64_t ColumnFile::GetRowCount() const
+{
+    return header ? header->rowCount : 0;
+}
+
+/**
+* @brief Checks whether the file has a column, e.g. an optional one added by a later writer
+* @param name Column name
+* @return true if a file is open and its directory lists the column
+*/
+bool ColumnFile::HasColumn(const std::string& name) const
+{
+    for (uint32_t column = 0; header != nullptr && column < header->columnCount; column++)
+    {
+        if (name == directory[column].name)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+* @brief Finds a column of the directory and checks its type
+* @param name Column name
+* @param type Expected type
+* @return Directory entry of the column
+* @throws std::runtime_error if no file is open, the column is missing or has another type
+*/
+const ColumnFile::ColumnEntry& ColumnFile::FindColumn(const std::string& name, ColumnType type) const
+{
+    if (header == nullptr)
+    {
+        throw std::runtime_error("ColumnFile: no file open");
+    }
+
+    for (uint32_t column = 0; column < header->columnCount; column++)
+    {
+        const ColumnEntry& entry = directory[column];
+        if (name == entry.name)
+        {
+            if (entry.type != static_cast<uint32_t>(type))
+            {
+                throw std::runtime_error("ColumnFile: column " + name + " has another type");
+            }
+            return entry;
+        }
+    }
+    throw std::runtime_error("ColumnFile: missing column " + name);
+}
+
+/**
+* @brief Writes a column file: header, directory, then every column on a 64-byte boundary
+*
+* The file is written next to path under a temporary name, then renamed over it: a column file that is
+* still mapped (e.g. the one the columns come from) keeps its contents, and a failed write leaves path untouched.
+* @param path File to create (replaced if it exists)
+* @param rowCount Number of rows, stored in the header
+* @param columns Columns to write, in order
+* @throws std::runtime_error if a name is too long or the file cannot be written
+*/
+void ColumnFile::Write(const std::string& path, uint64_t rowCount, const std::vector<ColumnData>& columns)
+{
+    FileHeader fileHeader = {};
+    std::memcpy(fileHeader.magic, Magic, sizeof(Magic));
+    fileHeader.version = Version;
+    fileHeader.columnCount = static_cast<uint32_t>(columns.size());
+    fileHeader.rowCount = rowCount;
+    fileHeader.directoryOffset = sizeof(FileHeader);
+
+    std::vector<ColumnEntry> entries(columns.size());
+    uint64_t offset = AlignOffset(fileHeader.directoryOffset + columns.size() * sizeof(ColumnEntry));
+    for (size_t column = 0; column < columns.size(); column++)
+    {
+        if (columns[column].name.size() > MaxNameLength)
+        {
+            throw std::runtime_error("ColumnFile: column name too long: " + columns[column].name);
+        }
+
+        ColumnEntry& entry = entries[column];
+        std::memcpy(entry.name, columns[column].name.c_str(), columns[column].name.size() + 1);
+        entry.type = static_cast<uint32_t>(columns[column].type);
+        entry.offset = offset;
+        entry.size = columns[column].size;
+        offset = AlignOffset(offset + entry.size);
+    }
+
+    const std::string temporaryPath = path + ".tmp";
+    std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(&fileHeader), sizeof(fileHeader));
+    file.write(reinterpret_cast<const char*>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(ColumnEntry)));
+
+    const char padding[Alignment] = {};
+    uint64_t written = sizeof(FileHeader) + entries.size() * sizeof(ColumnEntry);
+    for (size_t column = 0; column < columns.size(); column++)
+    {
+        file.write(padding, static_cast<std::streamsize>(entries[column].offset - written));
+        file.write(static_cast<const char*>(columns[column].data), static_cast<std::streamsize>(columns[column].size));
+        written = entries[column].offset + entries[column].size;
+    }
+    file.close();
+
+    std::error_code error;
+    if (file)
+    {
+        std::filesystem::rename(temporaryPath, path, error);
+    }
+    if (!file || error)
+    {
+        std::filesystem::remove(temporaryPath, error);
+        throw std::runtime_error("ColumnFile: cannot write " + path);
+    }
+}
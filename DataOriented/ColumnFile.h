@@ -0,0 +1,162 @@
+#pragma once
+
+#include <type_traits>
+#include <stdexcept>
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <span>
+
+/**
+ * @brief Binary columnar file, opened with a memory mapping
+ *
+ * Layout (little-endian): a 64-byte header (magic, version, row count, column count), a
+ * directory of 64-byte column entries (name, type, offset, size), then one segment per column,
+ * each starting on a 64-byte boundary so SIMD loads on the mapped columns are aligned.
+ * Variable-length strings are stored as two columns: a UInt64 offsets column (one entry per
+ * string, plus the end) and a Bytes heap.
+ *
+ * Open validates the header and the directory only, so opening costs the same for any row
+ * count; the pages are read by the OS as the columns are used. The mapping is copy-on-write:
+ * columns can be modified in memory without ever changing the file.
+ */
+class ColumnFile
+{
+public:
+
+    //////// STRUCTS ////////
+    enum class ColumnType : uint32_t
+    {
+        Int32,
+        UInt8,
+        UInt64,
+        Float64,
+        Bytes
+    };
+
+    /**
+     * @brief Column handed to Write: name, type and raw contents
+     */
+    struct ColumnData
+    {
+        std::string name;
+        ColumnType type;
+        const void* data;
+        size_t size;
+    };
+
+    //////// CONSTANTS ////////
+    static constexpr size_t Alignment = 64;
+    static constexpr size_t MaxNameLength = 39;
+
+    //////// CONSTRUCTOR ////////
+    ColumnFile() = default;
+    ColumnFile(ColumnFile&& other) noexcept;
+    ColumnFile& operator=(ColumnFile&& other) noexcept;
+    ~ColumnFile();
+
+    //////// DELETED METHODS ////////
+    ColumnFile(const ColumnFile&) = delete;
+    ColumnFile& operator=(const ColumnFile&) = delete;
+
+    //////// METHODS ////////
+    //// File
+    void Open(const std::string& path);
+    void Close();
+    bool IsOpen() const;
+
+    //// Columns
+    uint64_t GetRowCount() const;
+    bool HasColumn(const std::string& name) const;
+    template <typename T>
+    std::span<T> GetColumn(const std::string& name) const;
+
+    //////// STATIC METHODS ////////
+    static void Write(const std::string& path, uint64_t rowCount, const std::vector<ColumnData>& columns);
+
+private:
+
+    //////// STRUCTS ////////
+    struct FileHeader
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t columnCount;
+        uint64_t rowCount;
+        uint64_t directoryOffset;
+        uint8_t reserved[32];
+    };
+
+    struct ColumnEntry
+    {
+        char name[MaxNameLength + 1];
+        uint32_t type;
+        uint32_t reserved;
+        uint64_t offset;
+        uint64_t size;
+    };
+
+    static_assert(sizeof(FileHeader) == 64 && sizeof(ColumnEntry) == 64, "Header and entries are 64 bytes on disk");
+
+    //////// METHODS ////////
+    const ColumnEntry& FindColumn(const std::string& name, ColumnType type) const;
+
+    //////// STATIC METHODS ////////
+    template <typename T>
+    static constexpr ColumnType GetColumnType();
+
+    //////// FIELDS ////////
+    std::byte* mapping = nullptr;
+    size_t mappingSize = 0;
+    const FileHeader* header = nullptr;
+    const ColumnEntry* directory = nullptr;
+#if defined(_WIN32)
+    void* fileHandle = nullptr;
+    void* mappingHandle = nullptr;
+#endif
+};
+
+/**
+ * @brief Gets a column as a span over the mapping (valid until Close).
+ *
+ * T gives the expected type (int / int32_t, uint8_t, uint64_t, double, char; const or not).
+ * Writing through a non-const span only changes the private copy of the page.
+ *
+ * @throws std::runtime_error if the column is missing, has another type, or no file is open
+ */
+template <typename T>
+std::span<T> ColumnFile::GetColumn(const std::string& name) const
+{
+    const ColumnEntry& entry = FindColumn(name, GetColumnType<std::remove_const_t<T>>());
+    return std::span<T>(reinterpret_cast<T*>(mapping + entry.offset), entry.size / sizeof(T));
+}
+
+/**
+ * @brief Gets the on-disk type of a C++ element type.
+ */
+template <typename T>
+constexpr ColumnFile::ColumnType ColumnFile::GetColumnType()
+{
+    if constexpr (std::is_same_v<T, double>)
+    {
+        return ColumnType::Float64;
+    }
+    else if constexpr (std::is_same_v<T, uint64_t>)
+    {
+        return ColumnType::UInt64;
+    }
+    else if constexpr (std::is_same_v<T, uint8_t>)
+    {
+        return ColumnType::UInt8;
+    }
+    else if constexpr (std::is_same_v<T, char>)
+    {
+        return ColumnType::Bytes;
+    }
+    else
+    {
+        static_assert(std::is_integral_v<T> && std::is_signed_v<T> && sizeof(T) == 4, "Unsupported column element type");
+        return ColumnType::Int32;
+    }
+}
@@ -0,0 +1,254 @@
+#include "CsvReader.h"
+#include "../WorkerPool/ParallelChunks.h"
+
+#include <system_error>
+#include <filesystem>
+#include <algorithm>
+#include <stdexcept>
+
+namespace
+{
+    /**
+    * @brief Gets the start of the first line beginning at or after position
+    * @return Offset of that line, text.size() if there is none
+    */
+    size_t FindLineStart(std::string_view text, size_t position)
+    {
+        if (position == 0 || position >= text.size())
+        {
+            return std::min(position, text.size());
+        }
+
+        const size_t lineEnd = text.find('\n', position - 1);
+        return lineEnd == std::string_view::npos ? text.size() : lineEnd + 1;
+    }
+}
+
+/**
+* @brief Construct a new Csv Reader object, opening the file and reading its header line
+* @param pool Worker pool parsing the chunks
+* @param path CSV file
+* @param chunkSize Bytes read per chunk (a chunk grows only to fit a line longer than this)
+* @throws std::runtime_error if the file cannot be opened or its header is malformed
+*/
+CsvReader::CsvReader(WorkerPool& pool, const std::string& path, size_t chunkSize)
+    : pool(pool), file(path, std::ios::binary), path(path), chunkSize(std::max<size_t>(chunkSize, 1))
+{
+    if (!file)
+    {
+        throw std::runtime_error("CsvReader: cannot open " + path);
+    }
+
+    // A small file is read in one chunk of its size rather than in a mostly empty full-size buffer
+    std::error_code error;
+    const uintmax_t fileSize = std::filesystem::file_size(path, error);
+    if (!error && fileSize < this->chunkSize)
+    {
+        this->chunkSize = static_cast<size_t>(fileSize) + 1;
+    }
+    pieceCount = ParallelChunks::GetChunkCount(pool, this->chunkSize, 0);
+
+    std::string headerLine;
+    std::getline(file, headerLine);
+    dataOffset = headerLine.size() + (file.eof() ? 0 : 1);
+    endOfFile = !file;
+
+    std::string_view line(headerLine);
+    if (!line.empty() && line.back() == '\r')
+    {
+        line.remove_suffix(1);
+    }
+
+    std::vector<std::string_view> fields;
+    std::string unescaped;
+    if (!SplitFields(line, fields, unescaped))
+    {
+        throw std::runtime_error("CsvReader: malformed header in " + path);
+    }
+    header.assign(fields.begin(), fields.end());
+}
+
+/**
+* @brief Reads the rest of the file chunk by chunk
+*
+* For each chunk, parsePiece is called concurrently on its pieces (complete lines only; a piece can be
+* empty), then mergePieces is called on the calling thread once they are all parsed, so the pieces can
+* be appended in file order. The next chunk is read at the same time as the current one is parsed.
+* @param parsePiece Called as parsePiece(text, piece, fileOffset), piece being below GetPieceCount()
+* @param mergePieces Called as mergePieces(pieceCount) after each chunk
+* @throws std::runtime_error if the file cannot be read; exceptions of the callbacks are rethrown
+*/
+void CsvReader::Read(const ParsePiece& parsePiece, const MergePieces& mergePieces)
+{
+    std::vector<char> current;
+    std::vector<char> next;
+    size_t size = ReadChunk(current, 0);
+    uint64_t offset = dataOffset;
+
+    while (size > 0)
+    {
+        // Complete lines are parsed now, the line cut at the end of the chunk starts the next one
+        const bool lastChunk = endOfFile;
+        size_t parseSize = size;
+        if (!lastChunk)
+        {
+            const size_t lastLineEnd = std::string_view(current.data(), size).rfind('\n');
+            parseSize = lastLineEnd == std::string_view::npos ? 0 : lastLineEnd + 1;
+        }
+
+        const size_t carry = size - parseSize;
+        next.resize(std::max(next.size(), carry + chunkSize));
+        std::copy(current.begin() + parseSize, current.begin() + size, next.begin());
+
+        // Task 0 reads the next chunk (the calling thread starts it right away), the others parse one piece each
+        const std::string_view text(current.data(), parseSize);
+        const size_t firstPiece = lastChunk ? 0 : 1;
+        size_t nextSize = 0;
+        ParallelChunks::Run(pool, firstPiece + pieceCount, firstPiece + pieceCount, [&](size_t, size_t, size_t task)
+        {
+            if (task < firstPiece)
+            {
+                nextSize = ReadChunk(next, carry);
+                return;
+            }
+
+            const size_t piece = task - firstPiece;
+            const size_t begin = FindLineStart(text, piece * parseSize / pieceCount);
+            const size_t end = FindLineStart(text, (piece + 1) * parseSize / pieceCount);
+            parsePiece(text.substr(begin, end - begin), piece, offset + begin);
+        });
+        mergePieces(pieceCount);
+
+        offset += parseSize;
+        std::swap(current, next);
+        size = nextSize;
+    }
+}
+
+/**
+* @brief Reads up to chunkSize bytes after the carried bytes already at the start of the buffer
+* @param buffer Buffer, grown to fit if needed
+* @param carry Number of bytes kept at the start of the buffer
+* @return Number of bytes in the buffer
+*/
+size_t CsvReader::ReadChunk(std::vector<char>& buffer, size_t carry)
+{
+    buffer.resize(std::max(buffer.size(), carry + chunkSize));
+    if (endOfFile)
+    {
+        return carry;
+    }
+
+    file.read(buffer.data() + carry, static_cast<std::streamsize>(chunkSize));
+    if (file.bad())
+    {
+        throw std::runtime_error("CsvReader: cannot read " + path);
+    }
+    endOfFile = file.eof();
+    return carry + static_cast<size_t>(file.gcount());
+}
+
+/**
+* @brief Gets the column names of the header line
+* @return Header fields, in order
+*/
+const std::vector<std::string>& CsvReader::GetHeader() const
+{
+    return header;
+}
+
+/**
+* @brief Gets the number of pieces a chunk is cut into, the same for every chunk
+* @return Upper bound of the piece indices passed to the parse callback
+*/
+size_t CsvReader::GetPieceCount() const
+{
+    return pieceCount;
+}
+
+/**
+* @brief Takes the next non-blank line off the front of a text, without its line break
+* @param text Remaining text, advanced past the line
+* @param line Output line
+* @return false once the text holds no more lines
+*/
+bool CsvReader::NextLine(std::string_view& text, std::string_view& line)
+{
+    while (!text.empty())
+    {
+        const size_t lineEnd = text.find('\n');
+        line = text.substr(0, lineEnd);
+        text.remove_prefix(lineEnd == std::string_view::npos ? text.size() : lineEnd + 1);
+
+        if (!line.empty() && line.back() == '\r')
+        {
+            line.remove_suffix(1);
+        }
+        if (!line.empty())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+* @brief Splits a line into its fields; unquoted fields are views of the line, quoted ones of unescaped
+* @param line Line, without its line break
+* @param fields Output fields, cleared first
+* @param unescaped Storage for the quoted fields' contents, cleared first
+* @return false if a quoted field is not closed or is followed by something else than a comma
+*/
+bool CsvReader::SplitFields(std::string_view line, std::vector<std::string_view>& fields, std::string& unescaped)
+{
+    fields.clear();
+    unescaped.clear();
+    // Unescaped text is never longer than the line, so the views into it are not invalidated by a reallocation
+    unescaped.reserve(line.size());
+
+    size_t position = 0;
+    while (true)
+    {
+        if (position < line.size() && line[position] == '"')
+        {
+            const size_t fieldStart = unescaped.size();
+            bool closed = false;
+            position++;
+            while (position < line.size() && !closed)
+            {
+                const char character = line[position++];
+                if (character != '"')
+                {
+                    unescaped += character;
+                }
+                else if (position < line.size() && line[position] == '"')
+                {
+                    unescaped += '"';
+                    position++;
+                }
+                else
+                {
+                    closed = true;
+                }
+            }
+
+            if (!closed || (position < line.size() && line[position] != ','))
+            {
+                return false;
+            }
+            fields.emplace_back(unescaped.data() + fieldStart, unescaped.size() - fieldStart);
+        }
+        else
+        {
+            const size_t fieldEnd = std::min(line.find(',', position), line.size());
+            fields.push_back(line.substr(position, fieldEnd - position));
+            position = fieldEnd;
+        }
+
+        if (position >= line.size())
+        {
+            return true;
+        }
+        position++;
+    }
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <string_view>
+#include <functional>
+#include <fstream>
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+class WorkerPool;
+
+/**
+ * @brief Streaming CSV reader parsing fixed-size chunks in parallel
+ *
+ * The file is read chunkSize bytes at a time into one of two buffers: while the pool's threads
+ * parse a chunk, the next one is read into the other buffer, so reading and parsing overlap. Each
+ * chunk is cut into line-aligned pieces parsed concurrently, and a line cut by the end of a chunk
+ * is carried over to the next one. Memory stays bounded by two chunks (plus what the callbacks
+ * keep), whatever the file size.
+ *
+ * Records are single lines ('\n' or "\r\n", blank lines skipped) with comma-separated fields; a
+ * field may be double-quoted ("" for a quote) but cannot contain a line break.
+ */
+class CsvReader
+{
+public:
+
+    //////// TYPES ////////
+    using ParsePiece = std::function<void(std::string_view text, size_t piece, uint64_t fileOffset)>;
+    using MergePieces = std::function<void(size_t pieceCount)>;
+
+    //////// CONSTANTS ////////
+    static constexpr size_t DefaultChunkSize = 8 << 20;
+
+    //////// CONSTRUCTOR ////////
+    CsvReader(WorkerPool& pool, const std::string& path, size_t chunkSize = DefaultChunkSize);
+
+    //////// METHODS ////////
+    //// Reading
+    void Read(const ParsePiece& parsePiece, const MergePieces& mergePieces);
+
+    //// Helpers
+    const std::vector<std::string>& GetHeader() const;
+    size_t GetPieceCount() const;
+
+    //////// STATIC METHODS ////////
+    static bool NextLine(std::string_view& text, std::string_view& line);
+    static bool SplitFields(std::string_view line, std::vector<std::string_view>& fields, std::string& unescaped);
+
+private:
+
+    //////// METHODS ////////
+    size_t ReadChunk(std::vector<char>& buffer, size_t carry);
+
+    //////// FIELDS ////////
+    WorkerPool& pool;
+    std::ifstream file;
+    std::string path;
+    std::vector<std::string> header;
+    size_t chunkSize;
+    size_t pieceCount;
+    uint64_t dataOffset = 0;
+    bool endOfFile = false;
+};
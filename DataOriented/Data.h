@@ -1,6 +1,8 @@
 #pragma once
 
 #include <iostream>
+#include <charconv>
+#include <fstream>
 #include <vector>
 #include <string>
 #include <random>
@@ -76,10 +78,10 @@ public:
         std::uniform_int_distribution<> dept_dist(0, departments.size() - 1);
         std::normal_distribution<> salary_dist(50000, 15000);
 
-        for (int i = 0; i < dataSize; ++i)
+        for (size_t i = 0; i < dataSize; ++i)
         {
             Employee emp;
-            emp.id = 1001 + i;
+            emp.id = 1001 + static_cast<int>(i);
             emp.name = firstNames[firstname_dist(rng)] + " " + lastNames[lastname_dist(rng)];
             emp.age = age_dist(rng);
             emp.department = departments[dept_dist(rng)];
@@ -92,4 +94,55 @@ public:
 
         return employees;
     }
+
+    /**
+     * @brief Writes employee data as CSV (header: id,name,age,department,salary)
+     *
+     * Names and departments holding a comma, a quote or a line break are quoted, their quotes doubled.
+     * ImportCsv reads quoted commas and quotes back, but rejects a line break inside a field.
+     * @param employees Employees to write
+     * @param path File to create
+     * @return false if the file could not be written
+     */
+    bool writeEmployeeCsv(const std::vector<Employee>& employees, const std::string& path) const
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << "id,name,age,department,salary\n";
+
+        auto writeText = [&file](const std::string& text)
+        {
+            if (text.find_first_of(",\"\r\n") == std::string::npos)
+            {
+                file << text;
+                return;
+            }
+
+            file << '"';
+            for (char c : text)
+            {
+                if (c == '"')
+                {
+                    file << '"';
+                }
+                file << c;
+            }
+            file << '"';
+        };
+
+        // Shortest text that parses back to the same salary
+        char salary[32];
+        for (const Employee& emp : employees)
+        {
+            const std::to_chars_result result = std::to_chars(salary, salary + sizeof(salary), emp.salary);
+            file << emp.id << ',';
+            writeText(emp.name);
+            file << ',' << emp.age << ',';
+            writeText(emp.department);
+            file << ',';
+            file.write(salary, result.ptr - salary);
+            file << '\n';
+        }
+
+        return static_cast<bool>(file);
+    }
 };
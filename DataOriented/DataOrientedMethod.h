@@ -1,54 +1,126 @@
 #pragma once
 
+#include "StringDictionary.h"
+#include "GroupAggregate.h"
+#include "ColumnFile.h"
+#include "CsvReader.h"
+#include "Predicate.h"
+#include "ZoneMap.h"
 #include "Data.h"
 
+#include <string_view>
+#include <cstdint>
 #include <vector>
 #include <string>
+#include <span>
 #include <map>
 
+class WorkerPool;
+
 /**
  * @brief Class implementing data-oriented approach for employee data management
  *
  * This class demonstrates data-oriented design patterns with data organized
- * for optimal cache usage and SIMD operations.
+ * for optimal cache usage and SIMD operations. Parallel loops run on the
+ * given WorkerPool's threads. Rows are addressed by 32-bit selection vectors,
+ * so a dataset holds at most 2^32 - 1 employees.
+ *
+ * The columns are views: either over vectors built by PrepareData or streamed
+ * from a CSV file by ImportCsv, or directly over a memory-mapped column file (see SaveColumnFile / OpenColumnFile), which
+ * makes a stored dataset queryable without reading or copying it.
  */
 class DataOrientedMethod
 {
 public:
+    //////// CONSTRUCTOR ////////
+    explicit DataOrientedMethod(WorkerPool& pool);
+
     //////// METHODS ////////
     //// Data Operations
     void PrepareData(const std::vector<Data::Employee>& data);
+    void SaveColumnFile(const std::string& path) const;
+    void OpenColumnFile(const std::string& path);
+    void ImportCsv(const std::string& path, size_t chunkSize = CsvReader::DefaultChunkSize);
     void IncreaseEmployeeSalary(double increase);
-    std::vector<size_t> GetEmployeeByIncome(double income) const;
-    void PrintEmployeeStats(const std::vector<size_t>& indices, const std::string& printTitle) const;
+    std::vector<uint32_t> GetEmployeeByIncome(double income) const;
+    std::vector<uint32_t> GetEmployeeByDepartment(const std::string& department) const;
+    std::vector<uint32_t> GetEmployeeByAge(int minAge, int maxAge) const;
+    std::vector<uint32_t> Select(const Predicate& predicate) const;
+    size_t Count(const Predicate& predicate) const;
+    std::vector<GroupResult> GroupBy(GroupKey key, Measure measure, int ageBucketWidth = 10) const;
+    std::vector<GroupResult> GroupBy(const std::vector<uint32_t>& indices, GroupKey key, Measure measure, int ageBucketWidth = 10) const;
+    void PrintEmployeeStats(const std::vector<uint32_t>& indices, const std::string& printTitle) const;
+
+    //// Helpers
+    size_t GetSize() const;
+    std::string_view GetEmployeeName(uint32_t row) const;
+    std::vector<std::string_view> GetEmployeeNames(const std::vector<uint32_t>& indices) const;
 
 
 private:
+    //////// METHODS ////////
+    template <typename M, typename F>
+    std::vector<uint32_t> SelectRows(M&& matchBlock, F&& selectBatch) const;
+    void BindOwnedColumns();
+    void BuildZoneMaps();
+
+    //// Aggregation
+    template <typename RowAt>
+    std::vector<GroupResult> AggregateGroups(size_t count, RowAt&& rowAt, GroupKey key, Measure measure, int ageBucketWidth) const;
+
+    //// Predicates
+    struct CompiledPredicate;
+    CompiledPredicate CompilePredicate(const Predicate& predicate) const;
+    ZoneMatch MatchBlock(const CompiledPredicate& predicate, uint32_t node, size_t block) const;
+    void EvaluateBlock(const CompiledPredicate& predicate, uint32_t node, size_t block, uint64_t* bits, uint64_t* scratch) const;
+
     //////// STRUCTS ////////
 
     /**
      * @brief Structure containing numeric employee data
      *
-     * Organized for optimal memory layout and SIMD operations
+     * Organized for optimal memory layout and SIMD operations. Ages and salaries
+     * have zone maps (min/max per block of rows) letting filters skip blocks.
      */
     struct NumericData
     {
-        std::vector<int> ids;
-        std::vector<int> ages;
-        std::vector<double> salaries;
+        std::span<int> ids;
+        std::span<int> ages;
+        std::span<double> salaries;
+        ZoneMap<int> ageZones;
+        ZoneMap<double> salaryZones;
     } numData;
 
     /**
      * @brief Structure containing textual employee data
      *
-     * Separated from numeric data to improve cache efficiency
+     * Separated from numeric data to improve cache efficiency. Departments are
+     * dictionary-encoded: one byte per row, the strings are stored once. Names
+     * are a string heap: name i is nameHeap[nameOffsets[i], nameOffsets[i + 1]).
      */
     struct TextData
     {
-        std::vector<std::string> names;
-        std::vector<std::string> departments;
+        std::span<const uint64_t> nameOffsets;
+        std::span<const char> nameHeap;
+        std::span<StringDictionary::Code> departments;
+        StringDictionary departmentDictionary;
     } textData;
 
+    /**
+     * @brief Storage behind the columns when they are built by PrepareData or ImportCsv
+     */
+    struct OwnedColumns
+    {
+        std::vector<int> ids;
+        std::vector<int> ages;
+        std::vector<double> salaries;
+        std::vector<uint64_t> nameOffsets;
+        std::vector<char> nameHeap;
+        std::vector<StringDictionary::Code> departments;
+    } ownedColumns;
+
     //////// FIELDS ////////
+    WorkerPool& pool;
+    ColumnFile columnFile;
     size_t dataSize = 0;
 };
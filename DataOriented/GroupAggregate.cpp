@@ -0,0 +1,102 @@
+#include "GroupAggregate.h"
+
+#include <cmath>
+
+/**
+* @brief Construct an empty Group Aggregate with the histogram range
+* @param low Smallest expected value
+* @param high Largest expected value
+*/
+GroupAggregate::GroupAggregate(double low, double high) : low(low), binScale(high > low ? BinCount / (high - low) : 0)
+{
+}
+
+/**
+* @brief Adds another partial aggregate of the same group (built with the same range)
+* @param other Partial aggregate to merge
+*/
+void GroupAggregate::Merge(const GroupAggregate& other)
+{
+    count += other.count;
+    sum += other.sum;
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+    for (size_t bin = 0; bin < BinCount; bin++)
+    {
+        bins[bin] += other.bins[bin];
+    }
+}
+
+/**
+* @brief Gets the number of values added
+* @return Count
+*/
+size_t GroupAggregate::GetCount() const
+{
+    return count;
+}
+
+/**
+* @brief Gets the sum of the values
+* @return Sum, 0 for an empty group
+*/
+double GroupAggregate::GetSum() const
+{
+    return sum;
+}
+
+/**
+* @brief Gets the smallest value
+* @return Minimum, +infinity for an empty group
+*/
+double GroupAggregate::GetMin() const
+{
+    return min;
+}
+
+/**
+* @brief Gets the largest value
+* @return Maximum, -infinity for an empty group
+*/
+double GroupAggregate::GetMax() const
+{
+    return max;
+}
+
+/**
+* @brief Gets the mean of the values
+* @return Average, NaN for an empty group
+*/
+double GroupAggregate::GetAverage() const
+{
+    return count == 0 ? std::nan("") : sum / static_cast<double>(count);
+}
+
+/**
+* @brief Gets an approximate percentile, interpolated inside the histogram bin holding it
+* @param fraction Share of the values below the result, e.g. 0.5 for the median, 0.9 for the 90th percentile
+* @return Percentile within one bin width (clamped to [min, max]), NaN for an empty group
+*/
+double GroupAggregate::GetPercentile(double fraction) const
+{
+    if (count == 0)
+    {
+        return std::nan("");
+    }
+    if (binScale == 0)
+    {
+        return std::clamp(low, min, max);
+    }
+
+    const double rank = std::clamp(fraction, 0.0, 1.0) * static_cast<double>(count);
+    double below = 0;
+    size_t bin = 0;
+    while (bin < BinCount - 1 && below + bins[bin] < rank)
+    {
+        below += bins[bin];
+        bin++;
+    }
+
+    const double inBin = bins[bin] == 0 ? 0 : (rank - below) / bins[bin];
+    return std::clamp(low + (static_cast<double>(bin) + inBin) / binScale, min, max);
+}
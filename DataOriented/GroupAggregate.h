@@ -0,0 +1,100 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <array>
+
+/**
+ * @brief Column grouping the rows of a GroupBy
+ */
+enum class GroupKey : uint8_t
+{
+    Department,
+    AgeBucket
+};
+
+/**
+ * @brief Column aggregated by a GroupBy
+ */
+enum class Measure : uint8_t
+{
+    Salary,
+    Age
+};
+
+/**
+ * @brief Mergeable aggregate of one group: count, sum, min, max and a histogram for percentiles
+ *
+ * Partial aggregates are built independently (one per chunk of rows) and merged at the end, so
+ * a whole group-by is one parallel pass. Percentiles come from a linear histogram of BinCount
+ * bins over a range fixed up front (e.g. the column's zone-map bounds): they are approximate,
+ * within one bin width, and values outside the range fall in the first or last bin.
+ * NaN values are ignored.
+ */
+class GroupAggregate
+{
+public:
+
+    //////// CONSTANTS ////////
+    static constexpr size_t BinCount = 256;
+
+    //////// CONSTRUCTOR ////////
+    GroupAggregate() = default;
+    GroupAggregate(double low, double high);
+
+    //////// METHODS ////////
+    //// Aggregation
+    void Add(double value);
+    void Merge(const GroupAggregate& other);
+
+    //// Results
+    size_t GetCount() const;
+    double GetSum() const;
+    double GetMin() const;
+    double GetMax() const;
+    double GetAverage() const;
+    double GetPercentile(double fraction) const;
+
+private:
+
+    //////// FIELDS ////////
+    size_t count = 0;
+    double sum = 0;
+    double min = std::numeric_limits<double>::infinity();
+    double max = -std::numeric_limits<double>::infinity();
+    double low = 0;
+    double binScale = 0;
+    std::array<uint32_t, BinCount> bins = {};
+};
+
+/**
+ * @brief Result row of a GroupBy: group label and its aggregate
+ */
+struct GroupResult
+{
+    std::string group;
+    GroupAggregate aggregate;
+};
+
+/**
+ * @brief Adds one value (defined here so the per-row call inlines into the aggregation loops).
+ */
+inline void GroupAggregate::Add(double value)
+{
+    if (value != value)
+    {
+        return;
+    }
+
+    count++;
+    sum += value;
+    min = std::min(min, value);
+    max = std::max(max, value);
+
+    const double position = (value - low) * binScale;
+    const size_t bin = position <= 0 ? 0 : position >= BinCount - 1 ? BinCount - 1 : static_cast<size_t>(position);
+    bins[bin]++;
+}
@@ -1,10 +1,20 @@
 #include "ObjectOrientedMethod.h"
 #include "StatsHelper.h"
 #include "Data.h"
+#include "../WorkerPool/ParallelAlgorithms.h"
 
 #include <iostream>
+#include <utility>
 #include <map>
 
+/**
+* @brief Construct a new Object Oriented Method object
+* @param pool Worker pool running the parallel loops
+*/
+ObjectOrientedMethod::ObjectOrientedMethod(WorkerPool& pool) : pool(pool)
+{
+}
+
 /**
 * @brief Increases the salary of all employees
 * @param data Vector of employees to process
@@ -16,13 +26,15 @@ std::vector<Data::Employee> ObjectOrientedMethod::IncreaseEmployeeSalary(std::ve
 	std::vector<Data::Employee> newData;
     newData.resize(data.size());
 
-    #pragma omp parallel for
-    for (size_t i = 0; i < data.size(); i++)
+    ParallelFor(pool, 0, data.size(), [&data, &newData, increase](size_t begin, size_t end)
     {
-        Data::Employee newEmployee = data[i];
-        newEmployee.salary += increase;
-        newData[i] = newEmployee;
-    }
+        for (size_t i = begin; i < end; i++)
+        {
+            Data::Employee newEmployee = data[i];
+            newEmployee.salary += increase;
+            newData[i] = newEmployee;
+        }
+    });
 
 	return newData;
 }
@@ -61,15 +73,22 @@ void ObjectOrientedMethod::PrintEmployeeStats(const std::vector<Data::Employee>&
         return;
     }
 
-    double totalSalary = 0;
-    int totalAge = 0;
-
-    #pragma omp parallel for reduction(+:totalSalary,totalAge)
-    for (size_t i = 0; i < employees.size(); i++)
-    {
-        totalSalary += employees[i].salary;
-        totalAge += employees[i].age;
-    }
+    // Salary and age totals
+    const auto [totalSalary, totalAge] = ParallelReduce(pool, 0, employees.size(), std::pair<double, int>(0.0, 0),
+        [&employees](size_t begin, size_t end)
+        {
+            std::pair<double, int> totals(0.0, 0);
+            for (size_t i = begin; i < end; i++)
+            {
+                totals.first += employees[i].salary;
+                totals.second += employees[i].age;
+            }
+            return totals;
+        },
+        [](const std::pair<double, int>& a, const std::pair<double, int>& b)
+        {
+            return std::pair<double, int>(a.first + b.first, a.second + b.second);
+        });
 
     std::map<std::string, int> deptCount;
     for (const Data::Employee& emp : employees)
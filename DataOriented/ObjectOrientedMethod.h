@@ -5,20 +5,30 @@
 #include <vector>
 #include <string>
 
+class WorkerPool;
+
 /**
  * @brief Class implementing object-oriented approach for employee data management
  *
  * This class demonstrates traditional object-oriented programming patterns
- * for handling employee data operations.
+ * for handling employee data operations. Parallel loops run on the given
+ * WorkerPool's threads.
  */
 class ObjectOrientedMethod
 {
 public:
 
+    //////// CONSTRUCTOR ////////
+    explicit ObjectOrientedMethod(WorkerPool& pool);
+
     //////// METHODS ////////
     //// Data Operations
 	std::vector<Data::Employee> IncreaseEmployeeSalary(std::vector<Data::Employee> data, double increase) const;
 	std::vector<Data::Employee> GetEmployeeByIncome(std::vector<Data::Employee> data, double income) const;
 	void PrintEmployeeStats(const std::vector<Data::Employee>& employees, const std::string& printTitle) const;
 
+private:
+
+    //////// FIELDS ////////
+    WorkerPool& pool;
 };
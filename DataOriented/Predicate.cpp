@@ -0,0 +1,163 @@
+#include "Predicate.h"
+
+#include <limits>
+#include <utility>
+
+/**
+* @brief Construct a single-leaf predicate
+* @param leaf Leaf node
+*/
+Predicate::Predicate(Node leaf)
+{
+    nodes.push_back(std::move(leaf));
+}
+
+/**
+* @brief Matches salaries strictly greater than a value (NaN never matches)
+* @param salary Threshold
+* @return Leaf predicate
+*/
+Predicate Predicate::SalaryGreater(double salary)
+{
+    Node leaf{ Kind::SalaryGreater };
+    leaf.salary = salary;
+    return Predicate(std::move(leaf));
+}
+
+/**
+* @brief Matches salaries strictly less than a value (NaN never matches)
+* @param salary Threshold
+* @return Leaf predicate
+*/
+Predicate Predicate::SalaryLess(double salary)
+{
+    Node leaf{ Kind::SalaryLess };
+    leaf.salary = salary;
+    return Predicate(std::move(leaf));
+}
+
+/**
+* @brief Matches ages within [minAge, maxAge]
+* @param minAge Youngest matching age
+* @param maxAge Oldest matching age (nothing matches if below minAge)
+* @return Leaf predicate
+*/
+Predicate Predicate::AgeBetween(int minAge, int maxAge)
+{
+    Node leaf{ Kind::AgeBetween };
+    leaf.minAge = minAge;
+    leaf.maxAge = maxAge;
+    return Predicate(std::move(leaf));
+}
+
+/**
+* @brief Matches ages strictly less than a value
+* @param age Threshold
+* @return Leaf predicate
+*/
+Predicate Predicate::AgeLess(int age)
+{
+    if (age == std::numeric_limits<int>::min())
+    {
+        return AgeBetween(1, 0);
+    }
+    return AgeBetween(std::numeric_limits<int>::min(), age - 1);
+}
+
+/**
+* @brief Matches ages strictly greater than a value
+* @param age Threshold
+* @return Leaf predicate
+*/
+Predicate Predicate::AgeGreater(int age)
+{
+    if (age == std::numeric_limits<int>::max())
+    {
+        return AgeBetween(1, 0);
+    }
+    return AgeBetween(age + 1, std::numeric_limits<int>::max());
+}
+
+/**
+* @brief Matches the employees of any of the given departments (unknown names match nothing)
+* @param departments Department names
+* @return Leaf predicate
+*/
+Predicate Predicate::DepartmentIn(std::vector<std::string> departments)
+{
+    Node leaf{ Kind::DepartmentIn };
+    leaf.departments = std::move(departments);
+    return Predicate(std::move(leaf));
+}
+
+/**
+* @brief Matches the rows matching both predicates
+*/
+Predicate operator&&(Predicate left, Predicate right)
+{
+    return Predicate::Combine(Predicate::Kind::And, std::move(left), std::move(right));
+}
+
+/**
+* @brief Matches the rows matching either predicate
+*/
+Predicate operator||(Predicate left, Predicate right)
+{
+    return Predicate::Combine(Predicate::Kind::Or, std::move(left), std::move(right));
+}
+
+/**
+* @brief Matches the rows not matching the predicate
+*/
+Predicate operator!(Predicate operand)
+{
+    Predicate::Node node{ Predicate::Kind::Not };
+    node.left = operand.GetRoot();
+    operand.nodes.push_back(std::move(node));
+    return operand;
+}
+
+/**
+* @brief Appends the right predicate's nodes to the left one's and adds a binary operator as the root
+* @param kind And or Or
+* @param left First operand, reused as the result
+* @param right Second operand
+* @return Combined predicate
+*/
+Predicate Predicate::Combine(Kind kind, Predicate left, Predicate right)
+{
+    const uint32_t offset = static_cast<uint32_t>(left.nodes.size());
+    for (Node& node : right.nodes)
+    {
+        if (node.kind == Kind::And || node.kind == Kind::Or || node.kind == Kind::Not)
+        {
+            node.left += offset;
+            node.right += offset;
+        }
+        left.nodes.push_back(std::move(node));
+    }
+
+    Node root{ kind };
+    root.left = offset - 1;
+    root.right = static_cast<uint32_t>(left.nodes.size() - 1);
+    left.nodes.push_back(std::move(root));
+    return left;
+}
+
+/**
+* @brief Gets the expression nodes, children before their parent
+* @return Node array
+*/
+const std::vector<Predicate::Node>& Predicate::GetNodes() const
+{
+    return nodes;
+}
+
+/**
+* @brief Gets the index of the root node
+* @return Index of the last node
+*/
+uint32_t Predicate::GetRoot() const
+{
+    return static_cast<uint32_t>(nodes.size() - 1);
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Composable filter over the employee columns, evaluated by DataOrientedMethod::Select / Count
+ *
+ * Leaves compare one column (salary, age, department); they combine with &&, || and !.
+ * A predicate only describes the filter: it holds no data and can be reused on any dataset,
+ * department names being looked up in the dataset's dictionary when the query runs.
+ *
+ * The expression is stored as a flat node array, children before their parent and the root
+ * last, so evaluating it walks a small contiguous array rather than pointer-linked nodes.
+ */
+class Predicate
+{
+public:
+
+    //////// STRUCTS ////////
+    enum class Kind : uint8_t
+    {
+        SalaryGreater,
+        SalaryLess,
+        AgeBetween,
+        DepartmentIn,
+        And,
+        Or,
+        Not
+    };
+
+    /**
+     * @brief Expression node: a leaf with its operands, or an operator with its children's indices
+     */
+    struct Node
+    {
+        Kind kind;
+        uint32_t left = 0;
+        uint32_t right = 0;
+        double salary = 0;
+        int minAge = 0;
+        int maxAge = 0;
+        std::vector<std::string> departments = {};
+    };
+
+    //////// STATIC METHODS ////////
+    //// Leaves
+    static Predicate SalaryGreater(double salary);
+    static Predicate SalaryLess(double salary);
+    static Predicate AgeBetween(int minAge, int maxAge);
+    static Predicate AgeLess(int age);
+    static Predicate AgeGreater(int age);
+    static Predicate DepartmentIn(std::vector<std::string> departments);
+
+    //////// OPERATORS ////////
+    friend Predicate operator&&(Predicate left, Predicate right);
+    friend Predicate operator||(Predicate left, Predicate right);
+    friend Predicate operator!(Predicate operand);
+
+    //////// METHODS ////////
+    const std::vector<Node>& GetNodes() const;
+    uint32_t GetRoot() const;
+
+private:
+
+    //////// CONSTRUCTOR ////////
+    explicit Predicate(Node leaf);
+
+    //////// STATIC METHODS ////////
+    static Predicate Combine(Kind kind, Predicate left, Predicate right);
+
+    //////// FIELDS ////////
+    std::vector<Node> nodes;
+};
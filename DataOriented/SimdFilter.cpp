@@ -0,0 +1,668 @@
+#include "SimdFilter.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define DATAORIENTED_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+// MSVC compiles intrinsics of any instruction set as is; GCC and Clang need the target enabled per function
+#if defined(DATAORIENTED_X86) && !defined(_MSC_VER)
+#define DATAORIENTED_TARGET(isa) __attribute__((target(isa)))
+#else
+#define DATAORIENTED_TARGET(isa)
+#endif
+
+namespace
+{
+    //// Positions of the set bits of every 4-bit compare mask, so a compacted index group is one add away
+    constexpr std::array<std::array<uint32_t, 4>, 16> MakeCompactOffsets()
+    {
+        std::array<std::array<uint32_t, 4>, 16> offsets = {};
+        for (uint32_t mask = 0; mask < 16; mask++)
+        {
+            uint32_t selected = 0;
+            for (uint32_t lane = 0; lane < 4; lane++)
+            {
+                if (mask & (1u << lane))
+                {
+                    offsets[mask][selected++] = lane;
+                }
+            }
+        }
+        return offsets;
+    }
+
+    alignas(16) constexpr std::array<std::array<uint32_t, 4>, 16> CompactOffsets = MakeCompactOffsets();
+
+    /**
+    * @brief Branchless scalar kernel: every index is written, the output position only advances on a match
+    */
+    size_t SelectGreaterScalar(const double* values, size_t count, double threshold, uint32_t firstIndex, uint32_t* selection)
+    {
+        size_t selected = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            selection[selected] = firstIndex + static_cast<uint32_t>(i);
+            selected += values[i] > threshold ? 1 : 0;
+        }
+        return selected;
+    }
+
+    /**
+    * @brief Branchless scalar kernel for one-byte codes
+    */
+    size_t SelectEqualScalar(const uint8_t* codes, size_t count, uint8_t code, uint32_t firstIndex, uint32_t* selection)
+    {
+        size_t selected = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            selection[selected] = firstIndex + static_cast<uint32_t>(i);
+            selected += codes[i] == code ? 1 : 0;
+        }
+        return selected;
+    }
+
+    /**
+    * @brief Branchless scalar kernel for an inclusive range: one unsigned compare of the offset from minValue
+    *
+    * Requires minValue <= maxValue.
+    */
+    size_t SelectBetweenScalar(const int32_t* values, size_t count, int32_t minValue, int32_t maxValue, uint32_t firstIndex, uint32_t* selection)
+    {
+        const uint32_t range = static_cast<uint32_t>(maxValue) - static_cast<uint32_t>(minValue);
+        size_t selected = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            selection[selected] = firstIndex + static_cast<uint32_t>(i);
+            selected += static_cast<uint32_t>(values[i]) - static_cast<uint32_t>(minValue) <= range ? 1 : 0;
+        }
+        return selected;
+    }
+
+    /**
+    * @brief Scalar bitmap kernel: packs test(i) for rows firstRow to count - 1, starting at a word boundary
+    */
+    template <typename Test>
+    void MarkScalar(size_t firstRow, size_t count, uint64_t* bits, Test&& test)
+    {
+        for (size_t begin = firstRow; begin < count; begin += 64)
+        {
+            const size_t end = std::min(begin + 64, count);
+            uint64_t word = 0;
+            for (size_t i = begin; i < end; i++)
+            {
+                word |= static_cast<uint64_t>(test(i)) << (i - begin);
+            }
+            bits[begin / 64] = word;
+        }
+    }
+
+#if defined(DATAORIENTED_X86)
+    /**
+    * @brief AVX2 bitmap kernel for doubles: 16 compare masks of 4 bits per 64-row word
+    */
+    template <int Compare>
+    DATAORIENTED_TARGET("avx2")
+    size_t MarkCompareAVX2(const double* values, size_t count, double threshold, uint64_t* bits)
+    {
+        const __m256d limit = _mm256_set1_pd(threshold);
+        size_t i = 0;
+        for (; i + 64 <= count; i += 64)
+        {
+            uint64_t word = 0;
+            for (size_t group = 0; group < 64; group += 4)
+            {
+                const int mask = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(values + i + group), limit, Compare));
+                word |= static_cast<uint64_t>(mask) << group;
+            }
+            bits[i / 64] = word;
+        }
+        return i;
+    }
+
+    /**
+    * @brief AVX-512 bitmap kernel for doubles: 8 compare masks of 8 bits per 64-row word
+    */
+    template <int Compare>
+    DATAORIENTED_TARGET("avx512f")
+    size_t MarkCompareAVX512(const double* values, size_t count, double threshold, uint64_t* bits)
+    {
+        const __m512d limit = _mm512_set1_pd(threshold);
+        size_t i = 0;
+        for (; i + 64 <= count; i += 64)
+        {
+            uint64_t word = 0;
+            for (size_t group = 0; group < 64; group += 8)
+            {
+                const __mmask8 mask = _mm512_cmp_pd_mask(_mm512_loadu_pd(values + i + group), limit, Compare);
+                word |= static_cast<uint64_t>(mask) << group;
+            }
+            bits[i / 64] = word;
+        }
+        return i;
+    }
+
+    /**
+    * @brief AVX2 bitmap kernel for an inclusive int range: 8 masks of 8 bits per 64-row word
+    */
+    DATAORIENTED_TARGET("avx2")
+    size_t MarkBetweenAVX2(const int32_t* values, size_t count, int32_t minValue, int32_t maxValue, uint64_t* bits)
+    {
+        const __m256i lowest = _mm256_set1_epi32(minValue);
+        const __m256i range = _mm256_set1_epi32(static_cast<int>(static_cast<uint32_t>(maxValue) - static_cast<uint32_t>(minValue)));
+        size_t i = 0;
+        for (; i + 64 <= count; i += 64)
+        {
+            uint64_t word = 0;
+            for (size_t group = 0; group < 64; group += 8)
+            {
+                const __m256i offsets = _mm256_sub_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i + group)), lowest);
+                const __m256i inRange = _mm256_cmpeq_epi32(_mm256_min_epu32(offsets, range), offsets);
+                word |= static_cast<uint64_t>(_mm256_movemask_ps(_mm256_castsi256_ps(inRange))) << group;
+            }
+            bits[i / 64] = word;
+        }
+        return i;
+    }
+
+    /**
+    * @brief AVX-512 bitmap kernel for an inclusive int range: 4 masks of 16 bits per 64-row word
+    */
+    DATAORIENTED_TARGET("avx512f")
+    size_t MarkBetweenAVX512(const int32_t* values, size_t count, int32_t minValue, int32_t maxValue, uint64_t* bits)
+    {
+        const __m512i lowest = _mm512_set1_epi32(minValue);
+        const __m512i range = _mm512_set1_epi32(static_cast<int>(static_cast<uint32_t>(maxValue) - static_cast<uint32_t>(minValue)));
+        size_t i = 0;
+        for (; i + 64 <= count; i += 64)
+        {
+            uint64_t word = 0;
+            for (size_t group = 0; group < 64; group += 16)
+            {
+                const __m512i offsets = _mm512_sub_epi32(_mm512_loadu_si512(values + i + group), lowest);
+                word |= static_cast<uint64_t>(_mm512_cmple_epu32_mask(offsets, range)) << group;
+            }
+            bits[i / 64] = word;
+        }
+        return i;
+    }
+
+    /**
+    * @brief AVX2 bitmap kernel for a small code set: one byte compare per set member, 2 x 32-bit masks per word
+    */
+    DATAORIENTED_TARGET("avx2")
+    size_t MarkInAVX2(const uint8_t* codes, size_t count, const uint8_t* setCodes, size_t setSize, uint64_t* bits)
+    {
+        __m256i targets[4];
+        for (size_t member = 0; member < setSize; member++)
+        {
+            targets[member] = _mm256_set1_epi8(static_cast<char>(setCodes[member]));
+        }
+
+        size_t i = 0;
+        for (; i + 64 <= count; i += 64)
+        {
+            uint64_t word = 0;
+            for (size_t group = 0; group < 64; group += 32)
+            {
+                const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(codes + i + group));
+                __m256i matches = _mm256_setzero_si256();
+                for (size_t member = 0; member < setSize; member++)
+                {
+                    matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(block, targets[member]));
+                }
+                word |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(matches))) << group;
+            }
+            bits[i / 64] = word;
+        }
+        return i;
+    }
+
+    /**
+    * @brief AVX2 kernel for one-byte codes: 32 compares per instruction, then one index per set bit of the mask
+    *
+    * Dictionary predicates usually match a small share of the rows, so walking the set bits costs less than
+    * compacting every group; blocks without any match cost one compare and one test.
+    */
+    DATAORIENTED_TARGET("avx2,bmi")
+    size_t SelectEqualAVX2(const uint8_t* codes, size_t count, uint8_t code, uint32_t firstIndex, uint32_t* selection)
+    {
+        const __m256i target = _mm256_set1_epi8(static_cast<char>(code));
+        size_t selected = 0;
+        size_t i = 0;
+
+        for (; i + 32 <= count; i += 32)
+        {
+            const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(codes + i));
+            uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, target)));
+            while (mask != 0)
+            {
+                selection[selected++] = firstIndex + static_cast<uint32_t>(i) + static_cast<uint32_t>(_tzcnt_u32(mask));
+                mask &= mask - 1;
+            }
+        }
+
+        return selected + SelectEqualScalar(codes + i, count - i, code, firstIndex + static_cast<uint32_t>(i), selection + selected);
+    }
+
+    /**
+    * @brief AVX2 kernel: 4 compares per instruction, the 4-bit mask picks the compacted offsets from a table
+    *
+    * A group of 4 indices is always stored; only popcount(mask) of them are kept. The store cannot overflow the
+    * selection since the output position never gets ahead of the input position.
+    */
+    DATAORIENTED_TARGET("avx2,popcnt")
+    size_t SelectGreaterAVX2(const double* values, size_t count, double threshold, uint32_t firstIndex, uint32_t* selection)
+    {
+        const __m256d limit = _mm256_set1_pd(threshold);
+        size_t selected = 0;
+        size_t i = 0;
+
+        for (; i + 4 <= count; i += 4)
+        {
+            const int mask = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(values + i), limit, _CMP_GT_OQ));
+            const __m128i offsets = _mm_load_si128(reinterpret_cast<const __m128i*>(CompactOffsets[mask].data()));
+            const __m128i indices = _mm_add_epi32(_mm_set1_epi32(static_cast<int>(firstIndex + i)), offsets);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(selection + selected), indices);
+            selected += static_cast<size_t>(_mm_popcnt_u32(static_cast<unsigned>(mask)));
+        }
+
+        return selected + SelectGreaterScalar(values + i, count - i, threshold, firstIndex + static_cast<uint32_t>(i), selection + selected);
+    }
+
+    /**
+    * @brief AVX2 range kernel: 8 ints per iteration (unsigned compare as min_epu32 + cmpeq), each half of the
+    *        8-bit mask compacted with the same table as the double kernel
+    */
+    DATAORIENTED_TARGET("avx2,popcnt")
+    size_t SelectBetweenAVX2(const int32_t* values, size_t count, int32_t minValue, int32_t maxValue, uint32_t firstIndex, uint32_t* selection)
+    {
+        const __m256i lowest = _mm256_set1_epi32(minValue);
+        const __m256i range = _mm256_set1_epi32(static_cast<int>(static_cast<uint32_t>(maxValue) - static_cast<uint32_t>(minValue)));
+        size_t selected = 0;
+        size_t i = 0;
+
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256i offsets = _mm256_sub_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i)), lowest);
+            const __m256i inRange = _mm256_cmpeq_epi32(_mm256_min_epu32(offsets, range), offsets);
+            const int mask = _mm256_movemask_ps(_mm256_castsi256_ps(inRange));
+
+            const int lowMask = mask & 0xF;
+            const __m128i lowIndices = _mm_add_epi32(_mm_set1_epi32(static_cast<int>(firstIndex + i)),
+                                                     _mm_load_si128(reinterpret_cast<const __m128i*>(CompactOffsets[lowMask].data())));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(selection + selected), lowIndices);
+            selected += static_cast<size_t>(_mm_popcnt_u32(static_cast<unsigned>(lowMask)));
+
+            const int highMask = mask >> 4;
+            const __m128i highIndices = _mm_add_epi32(_mm_set1_epi32(static_cast<int>(firstIndex + i + 4)),
+                                                      _mm_load_si128(reinterpret_cast<const __m128i*>(CompactOffsets[highMask].data())));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(selection + selected), highIndices);
+            selected += static_cast<size_t>(_mm_popcnt_u32(static_cast<unsigned>(highMask)));
+        }
+
+        return selected + SelectBetweenScalar(values + i, count - i, minValue, maxValue, firstIndex + static_cast<uint32_t>(i), selection + selected);
+    }
+
+    /**
+    * @brief AVX-512 range kernel: 16 ints per iteration, unsigned compare to a mask, compress store
+    */
+    DATAORIENTED_TARGET("avx512f,popcnt")
+    size_t SelectBetweenAVX512(const int32_t* values, size_t count, int32_t minValue, int32_t maxValue, uint32_t firstIndex, uint32_t* selection)
+    {
+        const __m512i lowest = _mm512_set1_epi32(minValue);
+        const __m512i range = _mm512_set1_epi32(static_cast<int>(static_cast<uint32_t>(maxValue) - static_cast<uint32_t>(minValue)));
+        const __m512i step = _mm512_set1_epi32(16);
+        __m512i indices = _mm512_add_epi32(_mm512_set1_epi32(static_cast<int>(firstIndex)),
+                                           _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+        size_t selected = 0;
+        size_t i = 0;
+
+        for (; i + 16 <= count; i += 16)
+        {
+            const __m512i offsets = _mm512_sub_epi32(_mm512_loadu_si512(values + i), lowest);
+            const __mmask16 mask = _mm512_cmple_epu32_mask(offsets, range);
+            _mm512_mask_compressstoreu_epi32(selection + selected, mask, indices);
+            selected += static_cast<size_t>(_mm_popcnt_u32(mask));
+            indices = _mm512_add_epi32(indices, step);
+        }
+
+        return selected + SelectBetweenAVX2(values + i, count - i, minValue, maxValue, firstIndex + static_cast<uint32_t>(i), selection + selected);
+    }
+
+    /**
+    * @brief AVX-512 kernel: 2 x 8 compares per iteration, matching indices written with a single compress store
+    */
+    DATAORIENTED_TARGET("avx512f,popcnt")
+    size_t SelectGreaterAVX512(const double* values, size_t count, double threshold, uint32_t firstIndex, uint32_t* selection)
+    {
+        const __m512d limit = _mm512_set1_pd(threshold);
+        const __m512i step = _mm512_set1_epi32(16);
+        __m512i indices = _mm512_add_epi32(_mm512_set1_epi32(static_cast<int>(firstIndex)),
+                                           _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+        size_t selected = 0;
+        size_t i = 0;
+
+        for (; i + 16 <= count; i += 16)
+        {
+            const __mmask8 low = _mm512_cmp_pd_mask(_mm512_loadu_pd(values + i), limit, _CMP_GT_OQ);
+            const __mmask8 high = _mm512_cmp_pd_mask(_mm512_loadu_pd(values + i + 8), limit, _CMP_GT_OQ);
+            const __mmask16 mask = static_cast<__mmask16>(low | (high << 8));
+            _mm512_mask_compressstoreu_epi32(selection + selected, mask, indices);
+            selected += static_cast<size_t>(_mm_popcnt_u32(mask));
+            indices = _mm512_add_epi32(indices, step);
+        }
+
+        return selected + SelectGreaterAVX2(values + i, count - i, threshold, firstIndex + static_cast<uint32_t>(i), selection + selected);
+    }
+#endif
+
+    /**
+    * @brief Checks what the CPU (and the OS, for the wider registers' state) supports
+    */
+    SimdLevel DetectSimdLevel()
+    {
+#if defined(DATAORIENTED_X86) && defined(_MSC_VER)
+        int info[4] = {};
+        __cpuid(info, 1);
+        const bool osSavesAvx = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0;
+        if (!osSavesAvx)
+        {
+            return SimdLevel::Scalar;
+        }
+
+        const unsigned long long enabledState = _xgetbv(0);
+        __cpuidex(info, 7, 0);
+        if ((info[1] & (1 << 16)) != 0 && (enabledState & 0xE6) == 0xE6)
+        {
+            return SimdLevel::AVX512;
+        }
+        if ((info[1] & (1 << 5)) != 0 && (enabledState & 0x6) == 0x6)
+        {
+            return SimdLevel::AVX2;
+        }
+        return SimdLevel::Scalar;
+#elif defined(DATAORIENTED_X86)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f"))
+        {
+            return SimdLevel::AVX512;
+        }
+        if (__builtin_cpu_supports("avx2"))
+        {
+            return SimdLevel::AVX2;
+        }
+        return SimdLevel::Scalar;
+#else
+        return SimdLevel::Scalar;
+#endif
+    }
+}
+
+/**
+* @brief Writes the indices of the values strictly greater than threshold, using the best kernel of the CPU
+* @param values Column to filter
+* @param count Number of values
+* @param threshold Values must be greater than this (NaN never matches)
+* @param firstIndex Index of values[0], added to every written index
+* @param selection Output, with room for count indices
+* @return Number of indices written
+*/
+size_t SimdFilter::SelectGreater(const double* values, size_t count, double threshold, uint32_t firstIndex, uint32_t* selection)
+{
+    return SelectGreater(values, count, threshold, firstIndex, selection, GetSimdLevel());
+}
+
+/**
+* @brief Same as SelectGreater, with a given kernel (lowered to what the CPU supports)
+* @param level Kernel to use, e.g. Scalar to measure the SIMD gain
+* @return Number of indices written
+*/
+size_t SimdFilter::SelectGreater(const double* values, size_t count, double threshold, uint32_t firstIndex, uint32_t* selection, SimdLevel level)
+{
+#if defined(DATAORIENTED_X86)
+    switch (std::min(level, GetSimdLevel()))
+    {
+    case SimdLevel::AVX512:
+        return SelectGreaterAVX512(values, count, threshold, firstIndex, selection);
+    case SimdLevel::AVX2:
+        return SelectGreaterAVX2(values, count, threshold, firstIndex, selection);
+    default:
+        break;
+    }
+#endif
+    return SelectGreaterScalar(values, count, threshold, firstIndex, selection);
+}
+
+/**
+* @brief Writes the indices of the codes equal to code (dictionary-encoded equality), using the best kernel of the CPU
+* @param codes Dictionary-encoded column to filter
+* @param count Number of codes
+* @param code Code to match
+* @param firstIndex Index of codes[0], added to every written index
+* @param selection Output, with room for count indices
+* @return Number of indices written
+*/
+size_t SimdFilter::SelectEqual(const uint8_t* codes, size_t count, uint8_t code, uint32_t firstIndex, uint32_t* selection)
+{
+    return SelectEqual(codes, count, code, firstIndex, selection, GetSimdLevel());
+}
+
+/**
+* @brief Same as SelectEqual, with a given kernel (lowered to what the CPU supports; AVX-512 runs the AVX2 kernel)
+* @param level Kernel to use
+* @return Number of indices written
+*/
+size_t SimdFilter::SelectEqual(const uint8_t* codes, size_t count, uint8_t code, uint32_t firstIndex, uint32_t* selection, SimdLevel level)
+{
+#if defined(DATAORIENTED_X86)
+    if (std::min(level, GetSimdLevel()) >= SimdLevel::AVX2)
+    {
+        return SelectEqualAVX2(codes, count, code, firstIndex, selection);
+    }
+#endif
+    return SelectEqualScalar(codes, count, code, firstIndex, selection);
+}
+
+/**
+* @brief Writes the indices of the values within [minValue, maxValue], using the best kernel of the CPU
+* @param values Column to filter
+* @param count Number of values
+* @param minValue Smallest matching value
+* @param maxValue Largest matching value (nothing matches if below minValue)
+* @param firstIndex Index of values[0], added to every written index
+* @param selection Output, with room for count indices
+* @return Number of indices written
+*/
+size_t SimdFilter::SelectBetween(const int32_t* values, size_t count, int32_t minValue, int32_t maxValue, uint32_t firstIndex, uint32_t* selection)
+{
+    return SelectBetween(values, count, minValue, maxValue, firstIndex, selection, GetSimdLevel());
+}
+
+/**
+* @brief Same as SelectBetween, with a given kernel (lowered to what the CPU supports)
+* @param level Kernel to use
+* @return Number of indices written
+*/
+size_t SimdFilter::SelectBetween(const int32_t* values, size_t count, int32_t minValue, int32_t maxValue, uint32_t firstIndex, uint32_t* selection, SimdLevel level)
+{
+    if (minValue > maxValue)
+    {
+        return 0;
+    }
+
+#if defined(DATAORIENTED_X86)
+    switch (std::min(level, GetSimdLevel()))
+    {
+    case SimdLevel::AVX512:
+        return SelectBetweenAVX512(values, count, minValue, maxValue, firstIndex, selection);
+    case SimdLevel::AVX2:
+        return SelectBetweenAVX2(values, count, minValue, maxValue, firstIndex, selection);
+    default:
+        break;
+    }
+#endif
+    return SelectBetweenScalar(values, count, minValue, maxValue, firstIndex, selection);
+}
+
+/**
+* @brief Writes the bitmap of the values strictly greater than threshold (NaN never matches)
+* @param values Column to filter
+* @param count Number of values
+* @param threshold Values must be greater than this
+* @param bits Output, (count + 63) / 64 words
+*/
+void SimdFilter::MarkGreater(const double* values, size_t count, double threshold, uint64_t* bits)
+{
+    size_t marked = 0;
+#if defined(DATAORIENTED_X86)
+    switch (GetSimdLevel())
+    {
+    case SimdLevel::AVX512:
+        marked = MarkCompareAVX512<_CMP_GT_OQ>(values, count, threshold, bits);
+        break;
+    case SimdLevel::AVX2:
+        marked = MarkCompareAVX2<_CMP_GT_OQ>(values, count, threshold, bits);
+        break;
+    default:
+        break;
+    }
+#endif
+    MarkScalar(marked, count, bits, [values, threshold](size_t i) { return values[i] > threshold; });
+}
+
+/**
+* @brief Writes the bitmap of the values strictly less than threshold (NaN never matches)
+* @param values Column to filter
+* @param count Number of values
+* @param threshold Values must be less than this
+* @param bits Output, (count + 63) / 64 words
+*/
+void SimdFilter::MarkLess(const double* values, size_t count, double threshold, uint64_t* bits)
+{
+    size_t marked = 0;
+#if defined(DATAORIENTED_X86)
+    switch (GetSimdLevel())
+    {
+    case SimdLevel::AVX512:
+        marked = MarkCompareAVX512<_CMP_LT_OQ>(values, count, threshold, bits);
+        break;
+    case SimdLevel::AVX2:
+        marked = MarkCompareAVX2<_CMP_LT_OQ>(values, count, threshold, bits);
+        break;
+    default:
+        break;
+    }
+#endif
+    MarkScalar(marked, count, bits, [values, threshold](size_t i) { return values[i] < threshold; });
+}
+
+/**
+* @brief Writes the bitmap of the values within [minValue, maxValue]
+* @param values Column to filter
+* @param count Number of values
+* @param minValue Smallest matching value
+* @param maxValue Largest matching value (nothing matches if below minValue)
+* @param bits Output, (count + 63) / 64 words
+*/
+void SimdFilter::MarkBetween(const int32_t* values, size_t count, int32_t minValue, int32_t maxValue, uint64_t* bits)
+{
+    if (minValue > maxValue)
+    {
+        std::fill(bits, bits + (count + 63) / 64, 0);
+        return;
+    }
+
+    size_t marked = 0;
+#if defined(DATAORIENTED_X86)
+    switch (GetSimdLevel())
+    {
+    case SimdLevel::AVX512:
+        marked = MarkBetweenAVX512(values, count, minValue, maxValue, bits);
+        break;
+    case SimdLevel::AVX2:
+        marked = MarkBetweenAVX2(values, count, minValue, maxValue, bits);
+        break;
+    default:
+        break;
+    }
+#endif
+    const uint32_t range = static_cast<uint32_t>(maxValue) - static_cast<uint32_t>(minValue);
+    MarkScalar(marked, count, bits, [values, minValue, range](size_t i)
+    {
+        return static_cast<uint32_t>(values[i]) - static_cast<uint32_t>(minValue) <= range;
+    });
+}
+
+/**
+* @brief Writes the bitmap of the codes belonging to a set (byte compares for up to 4 codes, a lookup per row otherwise)
+* @param codes Dictionary-encoded column to filter
+* @param count Number of codes
+* @param codeSet 256-bit set: code c matches if bit c % 64 of codeSet[c / 64] is set
+* @param bits Output, (count + 63) / 64 words
+*/
+void SimdFilter::MarkIn(const uint8_t* codes, size_t count, const uint64_t* codeSet, uint64_t* bits)
+{
+    size_t marked = 0;
+#if defined(DATAORIENTED_X86)
+    // Small sets (the usual "department in {a, b}") compare a register of codes per member instead of a lookup per row
+    constexpr size_t MaxCompareSet = 4;
+    uint8_t setCodes[MaxCompareSet];
+    size_t setSize = 0;
+    for (size_t code = 0; code < 256 && setSize <= MaxCompareSet; code++)
+    {
+        if ((codeSet[code / 64] >> (code % 64)) & 1)
+        {
+            if (setSize < MaxCompareSet)
+            {
+                setCodes[setSize] = static_cast<uint8_t>(code);
+            }
+            setSize++;
+        }
+    }
+
+    if (setSize <= MaxCompareSet && GetSimdLevel() >= SimdLevel::AVX2)
+    {
+        marked = MarkInAVX2(codes, count, setCodes, setSize, bits);
+    }
+#endif
+    MarkScalar(marked, count, bits, [codes, codeSet](size_t i)
+    {
+        return (codeSet[codes[i] / 64] >> (codes[i] % 64)) & 1;
+    });
+}
+
+/**
+* @brief Gets the best instruction set of the CPU, detected on the first call
+* @return Level used by the filters
+*/
+SimdLevel SimdFilter::GetSimdLevel()
+{
+    static const SimdLevel level = DetectSimdLevel();
+    return level;
+}
+
+/**
+* @brief Gets the display name of an instruction set
+* @param level Instruction set
+* @return "Scalar", "AVX2" or "AVX-512"
+*/
+const char* SimdFilter::GetSimdLevelName(SimdLevel level)
+{
+    switch (level)
+    {
+    case SimdLevel::AVX512:
+        return "AVX-512";
+    case SimdLevel::AVX2:
+        return "AVX2";
+    default:
+        return "Scalar";
+    }
+}
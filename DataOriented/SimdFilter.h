@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Instruction set used by the filter kernels
+ */
+enum class SimdLevel : uint8_t
+{
+    Scalar,
+    AVX2,
+    AVX512
+};
+
+/**
+ * @brief Static helper class for SIMD column filters
+ *
+ * Kernels compare a whole register of values per instruction (4 doubles or 8 ints
+ * with AVX2, twice as many with AVX-512, 32 one-byte dictionary codes) and write the positions of the
+ * matching rows as a compacted 32-bit selection vector. The best kernel the
+ * CPU supports is picked once at runtime, with a branchless scalar fallback, so a
+ * single binary runs everywhere.
+ *
+ * The Mark kernels write a bitmap instead (row i is bit i % 64 of bits[i / 64], bits
+ * past count cleared), so several predicates can be combined with word operations
+ * before any index is written.
+ */
+class SimdFilter
+{
+public:
+
+    //////// STATIC METHODS ////////
+    //// Filters
+    static size_t SelectGreater(const double* values, size_t count, double threshold, uint32_t firstIndex, uint32_t* selection);
+    static size_t SelectGreater(const double* values, size_t count, double threshold, uint32_t firstIndex, uint32_t* selection, SimdLevel level);
+    static size_t SelectEqual(const uint8_t* codes, size_t count, uint8_t code, uint32_t firstIndex, uint32_t* selection);
+    static size_t SelectEqual(const uint8_t* codes, size_t count, uint8_t code, uint32_t firstIndex, uint32_t* selection, SimdLevel level);
+    static size_t SelectBetween(const int32_t* values, size_t count, int32_t minValue, int32_t maxValue, uint32_t firstIndex, uint32_t* selection);
+    static size_t SelectBetween(const int32_t* values, size_t count, int32_t minValue, int32_t maxValue, uint32_t firstIndex, uint32_t* selection, SimdLevel level);
+
+    //// Bitmaps
+    static void MarkGreater(const double* values, size_t count, double threshold, uint64_t* bits);
+    static void MarkLess(const double* values, size_t count, double threshold, uint64_t* bits);
+    static void MarkBetween(const int32_t* values, size_t count, int32_t minValue, int32_t maxValue, uint64_t* bits);
+    static void MarkIn(const uint8_t* codes, size_t count, const uint64_t* codeSet, uint64_t* bits);
+
+    //// CPU Features
+    static SimdLevel GetSimdLevel();
+    static const char* GetSimdLevelName(SimdLevel level);
+};
@@ -14,4 +14,26 @@ void StatsHelper::PrintStats(const std::string& title, int employeeCount, double
     printf("Total employees: %d\n", employeeCount);
     printf("Average age: %.0f years\n", avgAge);
     printf("Average salary: %.2f$\n", avgSalary);
+    for (const auto& [department, count] : deptCount)
+    {
+        printf("  %-24s %d\n", department.c_str(), count);
+    }
+}
+
+/**
+* @brief Prints a GroupBy result as a table, one line per group
+* @param title Title for the table
+* @param groups Groups and their aggregates
+*/
+void StatsHelper::PrintGroups(const std::string& title, const std::vector<GroupResult>& groups)
+{
+    printf("\n%s\n", title.c_str());
+    printf("%-24s %10s %12s %12s %12s %12s %12s %12s\n", "Group", "Count", "Average", "Min", "Max", "P50", "P90", "P99");
+    for (const GroupResult& result : groups)
+    {
+        const GroupAggregate& aggregate = result.aggregate;
+        printf("%-24s %10zu %12.2f %12.2f %12.2f %12.2f %12.2f %12.2f\n", result.group.c_str(), aggregate.GetCount(),
+               aggregate.GetAverage(), aggregate.GetMin(), aggregate.GetMax(),
+               aggregate.GetPercentile(0.5), aggregate.GetPercentile(0.9), aggregate.GetPercentile(0.99));
+    }
 }
@@ -1,8 +1,11 @@
 #pragma once
 
 #include <string>
+#include <vector>
 #include <map>
 
+#include "GroupAggregate.h"
+
 /**
  * @brief Static helper class for statistics printing
  *
@@ -15,5 +18,6 @@ public:
 
 	//////// STATIC METHODS ////////
 	static void PrintStats(const std::string& title, int employeeCount, double avgAge, double avgSalary, const std::map<std::string, int>& deptCount);
+	static void PrintGroups(const std::string& title, const std::vector<GroupResult>& groups);
 
 };
@@ -0,0 +1,62 @@
+#include "StringDictionary.h"
+
+#include <stdexcept>
+
+/**
+* @brief Gets the code of a value, adding it to the dictionary if it is new
+* @param value String to encode
+* @return Code of the value
+* @throws std::length_error if the dictionary already holds MaxSize values
+*/
+StringDictionary::Code StringDictionary::Encode(const std::string& value)
+{
+    auto existing = codes.find(value);
+    if (existing != codes.end())
+    {
+        return existing->second;
+    }
+
+    if (values.size() == MaxSize)
+    {
+        throw std::length_error("StringDictionary: more than 256 distinct values");
+    }
+
+    const Code code = static_cast<Code>(values.size());
+    values.push_back(value);
+    codes.emplace(value, code);
+    return code;
+}
+
+/**
+* @brief Gets the code of a value without adding it
+* @param value String to look up
+* @return Code of the value, or nothing if the column never contains it
+*/
+std::optional<StringDictionary::Code> StringDictionary::Find(const std::string& value) const
+{
+    auto existing = codes.find(value);
+    if (existing == codes.end())
+    {
+        return std::nullopt;
+    }
+    return existing->second;
+}
+
+/**
+* @brief Gets the string of a code
+* @param code Code returned by Encode
+* @return Value the code stands for
+*/
+const std::string& StringDictionary::Decode(Code code) const
+{
+    return values[code];
+}
+
+/**
+* @brief Gets the number of distinct values
+* @return Dictionary size, codes range from 0 to size - 1
+*/
+size_t StringDictionary::GetSize() const
+{
+    return values.size();
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <unordered_map>
+#include <optional>
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Dictionary encoding for low-cardinality text columns
+ *
+ * Each distinct string gets a one-byte code, in order of first appearance. The column
+ * then stores codes only, so grouping and equality predicates work on small integers
+ * (flat counter arrays, byte compares) and the strings are only looked up for display.
+ */
+class StringDictionary
+{
+public:
+
+    //////// TYPES ////////
+    using Code = uint8_t;
+
+    //////// CONSTANTS ////////
+    static constexpr size_t MaxSize = 256;
+
+    //////// METHODS ////////
+    //// Encoding
+    Code Encode(const std::string& value);
+    std::optional<Code> Find(const std::string& value) const;
+    const std::string& Decode(Code code) const;
+
+    //// Helpers
+    size_t GetSize() const;
+
+private:
+
+    //////// FIELDS ////////
+    std::vector<std::string> values;
+    std::unordered_map<std::string, Code> codes;
+};
@@ -0,0 +1,219 @@
+#pragma once
+
+#include <type_traits>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+#include <vector>
+#include <span>
+
+/**
+ * @brief How the rows of a block can match a predicate, according to the block's zone
+ */
+enum class ZoneMatch : uint8_t
+{
+    None,
+    Some,
+    All
+};
+
+/**
+ * @brief Block-level min/max summary (zone map) of a numeric column
+ *
+ * The column is cut into blocks of BlockSize rows, and each block keeps the smallest and largest
+ * of its values. A filter checks a block's zone first: a block that cannot match is skipped, a
+ * block that matches entirely is selected without reading its rows, and only the others are
+ * scanned. A floating-point block holding a NaN gets an unbounded zone, so it is always scanned.
+ *
+ * The zones must be updated along with the column: UpdateBlocks after a write, Shift after adding
+ * the same value to every row (exact, since rounding is monotonic).
+ */
+template <typename T>
+class ZoneMap
+{
+public:
+
+    //////// STRUCTS ////////
+    struct Zone
+    {
+        T min;
+        T max;
+    };
+
+    //////// CONSTANTS ////////
+    static constexpr size_t BlockSize = 4096;
+
+    //////// METHODS ////////
+    //// Maintenance
+    void Reset(size_t rowCount);
+    void UpdateBlocks(const T* values, size_t rowCount, size_t firstBlock, size_t lastBlock);
+    void Shift(T offset);
+    bool Load(std::span<const T> bounds, size_t rowCount);
+
+    //// Queries
+    ZoneMatch MatchGreater(size_t block, T threshold) const;
+    ZoneMatch MatchLess(size_t block, T threshold) const;
+    ZoneMatch MatchBetween(size_t block, T minValue, T maxValue) const;
+
+    //// Helpers
+    size_t GetBlockCount() const;
+    std::span<const T> GetBounds() const;
+
+    //////// STATIC METHODS ////////
+    static size_t GetBlockCount(size_t rowCount);
+
+private:
+
+    static_assert(std::is_arithmetic_v<T> && sizeof(Zone) == 2 * sizeof(T), "Zones are stored as min/max pairs");
+
+    //////// FIELDS ////////
+    std::vector<Zone> zones;
+};
+
+/**
+ * @brief Sizes the zone map for a column of rowCount rows; the zones must then be computed with UpdateBlocks.
+ */
+template <typename T>
+void ZoneMap<T>::Reset(size_t rowCount)
+{
+    zones.assign(GetBlockCount(rowCount), Zone{});
+}
+
+/**
+ * @brief Recomputes the zones of blocks firstBlock to lastBlock - 1 from the column (blocks are independent,
+ *        so disjoint block ranges can be updated concurrently).
+ */
+template <typename T>
+void ZoneMap<T>::UpdateBlocks(const T* values, size_t rowCount, size_t firstBlock, size_t lastBlock)
+{
+    for (size_t block = firstBlock; block < lastBlock; block++)
+    {
+        const size_t begin = block * BlockSize;
+        const size_t end = std::min(begin + BlockSize, rowCount);
+
+        T blockMin = values[begin];
+        T blockMax = values[begin];
+        bool unordered = false;
+        for (size_t i = begin; i < end; i++)
+        {
+            blockMin = std::min(blockMin, values[i]);
+            blockMax = std::max(blockMax, values[i]);
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                unordered |= values[i] != values[i];
+            }
+        }
+
+        if (unordered)
+        {
+            blockMin = -std::numeric_limits<T>::infinity();
+            blockMax = std::numeric_limits<T>::infinity();
+        }
+        zones[block] = { blockMin, blockMax };
+    }
+}
+
+/**
+ * @brief Moves every zone by offset, after offset was added to every value of the column.
+ */
+template <typename T>
+void ZoneMap<T>::Shift(T offset)
+{
+    for (Zone& zone : zones)
+    {
+        zone.min += offset;
+        zone.max += offset;
+    }
+}
+
+/**
+ * @brief Loads zones saved from GetBounds (min/max pairs).
+ *
+ * @return false, leaving the zone map untouched, if the bounds do not match a column of rowCount rows
+ */
+template <typename T>
+bool ZoneMap<T>::Load(std::span<const T> bounds, size_t rowCount)
+{
+    const size_t blockCount = GetBlockCount(rowCount);
+    if (bounds.size() != 2 * blockCount)
+    {
+        return false;
+    }
+
+    zones.resize(blockCount);
+    for (size_t block = 0; block < blockCount; block++)
+    {
+        zones[block] = { bounds[2 * block], bounds[2 * block + 1] };
+    }
+    return true;
+}
+
+/**
+ * @brief Checks which rows of a block can be strictly greater than threshold.
+ */
+template <typename T>
+ZoneMatch ZoneMap<T>::MatchGreater(size_t block, T threshold) const
+{
+    const Zone& zone = zones[block];
+    if (zone.min > threshold)
+    {
+        return ZoneMatch::All;
+    }
+    return zone.max > threshold ? ZoneMatch::Some : ZoneMatch::None;
+}
+
+/**
+ * @brief Checks which rows of a block can be strictly less than threshold.
+ */
+template <typename T>
+ZoneMatch ZoneMap<T>::MatchLess(size_t block, T threshold) const
+{
+    const Zone& zone = zones[block];
+    if (zone.max < threshold)
+    {
+        return ZoneMatch::All;
+    }
+    return zone.min < threshold ? ZoneMatch::Some : ZoneMatch::None;
+}
+
+/**
+ * @brief Checks which rows of a block can be within [minValue, maxValue].
+ */
+template <typename T>
+ZoneMatch ZoneMap<T>::MatchBetween(size_t block, T minValue, T maxValue) const
+{
+    const Zone& zone = zones[block];
+    if (zone.min >= minValue && zone.max <= maxValue)
+    {
+        return ZoneMatch::All;
+    }
+    return zone.max >= minValue && zone.min <= maxValue ? ZoneMatch::Some : ZoneMatch::None;
+}
+
+/**
+ * @brief Gets the number of blocks summarized.
+ */
+template <typename T>
+size_t ZoneMap<T>::GetBlockCount() const
+{
+    return zones.size();
+}
+
+/**
+ * @brief Gets the zones as min/max pairs, e.g. to save them.
+ */
+template <typename T>
+std::span<const T> ZoneMap<T>::GetBounds() const
+{
+    return std::span<const T>(reinterpret_cast<const T*>(zones.data()), 2 * zones.size());
+}
+
+/**
+ * @brief Gets the number of blocks of a column of rowCount rows.
+ */
+template <typename T>
+size_t ZoneMap<T>::GetBlockCount(size_t rowCount)
+{
+    return (rowCount + BlockSize - 1) / BlockSize;
+}
@@ -1,16 +1,25 @@
 #include "ObjectOrientedMethod.h"
 #include "DataOrientedMethod.h"
+#include "SimdFilter.h"
+#include "Predicate.h"
+#include "StatsHelper.h"
 #include "Data.h"
+#include "../WorkerPool/WorkerPool.h"
 
+#include <filesystem>
 #include <iomanip>
 #include <chrono>
 
 int main()
 {
     ////////////// Init //////////////
+    WorkerPoolConfig poolConfig;
+    poolConfig.logLevel = LogLevel::Warning;
+    WorkerPool pool(poolConfig);
+
     Data dataGenerator;
-    ObjectOrientedMethod OOP;
-    DataOrientedMethod DOD;
+    ObjectOrientedMethod OOP(pool);
+    DataOrientedMethod DOD(pool);
 
 	int dataSize = 10000;
     std::vector<Data::Employee> baseData = dataGenerator.createEmployeeData(dataSize);
@@ -35,29 +44,79 @@ int main()
 
     ////////////// Data Oriented Method //////////////
     printf("\n----------------------------------------------");
-    printf("\nStarting Data oriented...\n");
+    printf("\nStarting Data oriented (%s filter)...\n", SimdFilter::GetSimdLevelName(SimdFilter::GetSimdLevel()));
     printf("----------------------------------------------");
     DOD.PrepareData(baseData);
 
     auto startDOP = std::chrono::high_resolution_clock::now();
 
-    std::vector<size_t> DOD_EmployeeOver50k = DOD.GetEmployeeByIncome(50000);
+    std::vector<uint32_t> DOD_EmployeeOver50k = DOD.GetEmployeeByIncome(50000);
     DOD.IncreaseEmployeeSalary(10000);
-    std::vector<size_t> DOD_NewEmployeeOver50k = DOD.GetEmployeeByIncome(50000);
+    std::vector<uint32_t> DOD_NewEmployeeOver50k = DOD.GetEmployeeByIncome(50000);
 
     auto endDOP = std::chrono::high_resolution_clock::now();
     auto durationDOP = std::chrono::duration_cast<std::chrono::microseconds>(endDOP - startDOP);
 
     DOD.PrintEmployeeStats(DOD_EmployeeOver50k, "DOD data:");
     DOD.PrintEmployeeStats(DOD_NewEmployeeOver50k, "DOD after processing:");
+    DOD.PrintEmployeeStats(DOD.GetEmployeeByAge(30, 39), "DOD aged 30 to 39:");
+
+    const Predicate youngTechSales = Predicate::SalaryGreater(60000) && Predicate::AgeLess(40) && Predicate::DepartmentIn({ "IT", "Sales" });
+    DOD.PrintEmployeeStats(DOD.Select(youngTechSales), "DOD over 60k, under 40, in IT or Sales:");
+    printf("----------------------------------------------\n");
+
+    ////////////// Group By //////////////
+    auto startGroups = std::chrono::high_resolution_clock::now();
+    const std::vector<GroupResult> salaryByDepartment = DOD.GroupBy(GroupKey::Department, Measure::Salary);
+    const std::vector<GroupResult> salaryByAge = DOD.GroupBy(GroupKey::AgeBucket, Measure::Salary, 10);
+    auto endGroups = std::chrono::high_resolution_clock::now();
+    auto durationGroups = std::chrono::duration_cast<std::chrono::microseconds>(endGroups - startGroups);
+
+    StatsHelper::PrintGroups("DOD salary by department:", salaryByDepartment);
+    StatsHelper::PrintGroups("DOD salary by age:", salaryByAge);
+    printf("\nBoth reports aggregated in %lld microseconds (one parallel pass each)\n", static_cast<long long>(durationGroups.count()));
     printf("----------------------------------------------\n");
 
+    ////////////// Column File //////////////
+    const std::string columnFilePath = (std::filesystem::temp_directory_path() / "employees.dodcol").string();
+    DOD.SaveColumnFile(columnFilePath);
+    {
+        DataOrientedMethod mappedDOD(pool);
+
+        auto startOpen = std::chrono::high_resolution_clock::now();
+        mappedDOD.OpenColumnFile(columnFilePath);
+        auto endOpen = std::chrono::high_resolution_clock::now();
+        auto durationOpen = std::chrono::duration_cast<std::chrono::microseconds>(endOpen - startOpen);
+
+        printf("\nColumn file opened in %lld microseconds (%zu employees, mapped in place)\n", static_cast<long long>(durationOpen.count()), mappedDOD.GetSize());
+        mappedDOD.PrintEmployeeStats(mappedDOD.GetEmployeeByIncome(50000), "DOD from column file:");
+        printf("----------------------------------------------\n");
+    }
+    std::filesystem::remove(columnFilePath);
+
+    ////////////// CSV Ingest //////////////
+    const std::string csvPath = (std::filesystem::temp_directory_path() / "employees.csv").string();
+    if (dataGenerator.writeEmployeeCsv(baseData, csvPath))
+    {
+        DataOrientedMethod csvDOD(pool);
+
+        auto startImport = std::chrono::high_resolution_clock::now();
+        csvDOD.ImportCsv(csvPath);
+        auto endImport = std::chrono::high_resolution_clock::now();
+        auto durationImport = std::chrono::duration_cast<std::chrono::microseconds>(endImport - startImport);
+
+        printf("\nCSV imported in %lld microseconds (%zu employees, streamed into the columns)\n", static_cast<long long>(durationImport.count()), csvDOD.GetSize());
+        csvDOD.PrintEmployeeStats(csvDOD.GetEmployeeByIncome(50000), "DOD from CSV:");
+        printf("----------------------------------------------\n");
+    }
+    std::filesystem::remove(csvPath);
+
     double secondsOOP = durationOOP.count() / 1000000.0;
     double secondsDOD = durationDOP.count() / 1000000.0;
 
     printf("\nBenchmark Results:\n");
-    printf("OOP time: %.6fs (%lld microseconds)\n", secondsOOP, durationOOP.count());
-    printf("DOD time: %.6fs (%lld microseconds)\n", secondsDOD, durationDOP.count());
+    printf("OOP time: %.6fs (%lld microseconds)\n", secondsOOP, static_cast<long long>(durationOOP.count()));
+    printf("DOD time: %.6fs (%lld microseconds)\n", secondsDOD, static_cast<long long>(durationDOP.count()));
 
     return 0;
 }
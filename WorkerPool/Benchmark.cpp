@@ -0,0 +1,623 @@
+#include "LatencyHistogram.h"
+#include "WorkerPool.h"
+
+#include <algorithm>
+#include <iostream>
+#include <cstdlib>
+#include <new>
+#include <iomanip>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+/**
+ * @brief One measured configuration: the benchmark, its variant (scheduler, idle policy...), the worker count and its metrics
+ */
+struct BenchmarkResult
+{
+    std::string benchmark;
+    std::string variant;
+    uint32_t threads = 0;
+    std::vector<std::pair<std::string, double>> metrics;
+};
+
+/**
+ * @brief Benchmark parameters, from the command line
+ */
+struct BenchmarkOptions
+{
+    bool json = false;
+    bool quick = false;
+    uint32_t threads = std::max(1u, std::thread::hardware_concurrency());
+};
+
+/**
+ * @brief Keeps the results of the synthetic work alive so the compiler cannot drop it.
+ */
+std::atomic<uint64_t> workSink{ 0 };
+
+/**
+ * @brief Number of global operator new calls since startup, from any thread (see the replacements below).
+ */
+std::atomic<uint64_t> heapAllocations{ 0 };
+
+/**
+ * @brief Counting replacements of the global allocation functions.
+ *
+ * The array, nothrow and sized forms forward to these, so every heap allocation of the process is counted:
+ * the throughput benchmark uses it to show that a warm submit/execute cycle never allocates.
+ */
+void* operator new(std::size_t size)
+{
+    heapAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* block = std::malloc(size != 0 ? size : 1))
+    {
+        return block;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* block) noexcept
+{
+    std::free(block);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    heapAllocations.fetch_add(1, std::memory_order_relaxed);
+    const size_t align = static_cast<size_t>(alignment);
+#if defined(_WIN32)
+    void* block = _aligned_malloc(size != 0 ? size : 1, align);
+#else
+    void* block = std::aligned_alloc(align, (std::max<size_t>(size, 1) + align - 1) & ~(align - 1));
+#endif
+    if (block == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return block;
+}
+
+void operator delete(void* block, std::align_val_t) noexcept
+{
+#if defined(_WIN32)
+    _aligned_free(block);
+#else
+    std::free(block);
+#endif
+}
+
+/**
+ * @brief Burns a fixed amount of CPU (xorshift rounds).
+ *
+ * The amount of work is fixed rather than the duration, so oversubscribed threads take longer
+ * instead of appearing to run in parallel.
+ */
+void DoWork(uint64_t iterations)
+{
+    uint64_t state = iterations | 1;
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+    }
+    workSink.fetch_add(state, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Builds the config of a benchmark pool: no logging, so the queue and the scheduler are all that is measured.
+ */
+WorkerPoolConfig MakeConfig(uint32_t threads, SchedulerMode schedulerMode, IdlePolicy idlePolicy = IdlePolicy::Park)
+{
+    WorkerPoolConfig config;
+    config.schedulerMode = schedulerMode;
+    config.workerCount = threads;
+    config.idlePolicy = idlePolicy;
+    config.logLevel = LogLevel::Off;
+    return config;
+}
+
+/**
+ * @brief Get the name of a scheduler mode, as written in the results.
+ */
+const char* GetSchedulerName(SchedulerMode schedulerMode)
+{
+    return schedulerMode == SchedulerMode::WorkStealing ? "WorkStealing" : "SharedQueue";
+}
+
+/**
+ * @brief Get the seconds elapsed since start.
+ */
+double GetSecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Appends the count and percentiles of a latency summary to a result's metrics.
+ */
+void AddLatencyMetrics(BenchmarkResult& result, const std::string& prefix, const LatencySummary& latency)
+{
+    result.metrics.emplace_back(prefix + "Count", static_cast<double>(latency.count));
+    result.metrics.emplace_back(prefix + "P50Ns", static_cast<double>(latency.p50));
+    result.metrics.emplace_back(prefix + "P90Ns", static_cast<double>(latency.p90));
+    result.metrics.emplace_back(prefix + "P99Ns", static_cast<double>(latency.p99));
+    result.metrics.emplace_back(prefix + "MaxNs", static_cast<double>(latency.max));
+}
+
+/**
+ * @brief Empty-job throughput: how fast the pool queues and runs jobs that do nothing.
+ *
+ * Jobs are submitted one at a time (AddJob) and in a single batch (AddJobs), from a thread outside the pool.
+ * The same pass runs twice on each pool. The first one warms the queues and the job storage caches: the workers
+ * are held on gate jobs until it is all queued, so the queues grow to the deepest backlog a pass can reach. The
+ * second one is measured, along with the heap allocations it made (process-wide, and job storage misses from
+ * GetStats). One-by-one submission must report 0 for both; a batch allocates its std::vector<Job>.
+ */
+void RunThroughputBenchmark(const BenchmarkOptions& options, std::vector<BenchmarkResult>& results)
+{
+    const int numJobs = options.quick ? 100'000 : 1'000'000;
+
+    for (const SchedulerMode schedulerMode : { SchedulerMode::WorkStealing, SchedulerMode::SharedQueue })
+    {
+        for (const bool batched : { false, true })
+        {
+            std::cerr << "[Benchmark] Throughput (" << GetSchedulerName(schedulerMode) << (batched ? ", batched" : "") << ")\n";
+            WorkerPool pool(MakeConfig(options.threads, schedulerMode));
+
+            auto runPass = [&pool, batched, numJobs]()
+            {
+                if (batched)
+                {
+                    pool.AddJobs(static_cast<size_t>(numJobs), [](size_t)
+                    {
+                        return []() {};
+                    });
+                }
+                else
+                {
+                    for (int job = 0; job < numJobs; job++)
+                    {
+                        pool.AddJob([]() {});
+                    }
+                }
+            };
+
+            std::atomic<uint32_t> gatedWorkers{ 0 };
+            std::atomic<bool> gateOpen{ false };
+            for (uint32_t worker = 0; worker < options.threads; worker++)
+            {
+                pool.AddJob([&gatedWorkers, &gateOpen]()
+                {
+                    gatedWorkers++;
+                    while (!gateOpen.load())
+                    {
+                        std::this_thread::yield();
+                    }
+                });
+            }
+            while (gatedWorkers.load() < options.threads)
+            {
+                std::this_thread::yield();
+            }
+            runPass();
+            gateOpen = true;
+            pool.WaitForCompletion();
+            const uint64_t warmStorageAllocations = pool.GetStats().jobStorageHeapAllocations;
+            const uint64_t warmHeapAllocations = heapAllocations.load();
+
+            const auto start = std::chrono::steady_clock::now();
+            runPass();
+            const double submitSeconds = GetSecondsSince(start);
+            pool.WaitForCompletion();
+            const double seconds = GetSecondsSince(start);
+
+            const uint64_t passHeapAllocations = heapAllocations.load() - warmHeapAllocations;
+            const uint64_t passStorageAllocations = pool.GetStats().jobStorageHeapAllocations - warmStorageAllocations;
+
+            BenchmarkResult& result = results.emplace_back();
+            result.benchmark = batched ? "throughputBatch" : "throughput";
+            result.variant = GetSchedulerName(schedulerMode);
+            result.threads = options.threads;
+            result.metrics = { { "jobs", static_cast<double>(numJobs) }, { "seconds", seconds }, { "submitSeconds", submitSeconds },
+                               { "jobsPerSecond", numJobs / seconds }, { "heapAllocations", static_cast<double>(passHeapAllocations) },
+                               { "jobStorageHeapAllocations", static_cast<double>(passStorageAllocations) } };
+        }
+    }
+}
+
+/**
+ * @brief Submit-to-start latency of jobs arriving one by one on an otherwise idle pool.
+ *
+ * Jobs are paced a fixed gap apart, so the measured queue wait is the wake-up and pickup cost rather than a
+ * backlog. Measured for both schedulers with parking workers, and for work stealing with spinning workers.
+ */
+void RunLatencyBenchmark(const BenchmarkOptions& options, std::vector<BenchmarkResult>& results)
+{
+    const int numJobs = options.quick ? 2'000 : 20'000;
+    const std::chrono::microseconds gap(20);
+
+    struct LatencyVariant
+    {
+        SchedulerMode schedulerMode;
+        IdlePolicy idlePolicy;
+        const char* name;
+    };
+    const LatencyVariant variants[] = {
+        { SchedulerMode::WorkStealing, IdlePolicy::Park, "WorkStealing" },
+        { SchedulerMode::SharedQueue, IdlePolicy::Park, "SharedQueue" },
+        { SchedulerMode::WorkStealing, IdlePolicy::SpinThenPark, "WorkStealingSpin" }
+    };
+
+    for (const LatencyVariant& variant : variants)
+    {
+        std::cerr << "[Benchmark] Latency (" << variant.name << ")\n";
+        WorkerPool pool(MakeConfig(options.threads, variant.schedulerMode, variant.idlePolicy));
+
+        for (int job = 0; job < numJobs; job++)
+        {
+            pool.AddJob([]() {});
+
+            const auto nextSubmission = std::chrono::steady_clock::now() + gap;
+            while (std::chrono::steady_clock::now() < nextSubmission)
+            {
+            }
+        }
+        pool.WaitForCompletion();
+
+        BenchmarkResult& result = results.emplace_back();
+        result.benchmark = "latency";
+        result.variant = variant.name;
+        result.threads = options.threads;
+        result.metrics = { { "gapNs", static_cast<double>(std::chrono::nanoseconds(gap).count()) } };
+        AddLatencyMetrics(result, "queueWait", pool.GetLaneLatency(JobPriority::Normal));
+    }
+}
+
+/**
+ * @brief Mixed workload: mostly short jobs with a long one every LongJobInterval jobs, all on the Normal lane.
+ *
+ * Shows how long jobs hold up short ones: the queue-wait tail grows when short jobs get stuck behind long
+ * ones on the same worker.
+ */
+void RunMixedBenchmark(const BenchmarkOptions& options, std::vector<BenchmarkResult>& results)
+{
+    constexpr int LongJobInterval = 50;
+    constexpr uint64_t ShortJobWork = 500;
+    constexpr uint64_t LongJobWork = 200'000;
+    const int numJobs = options.quick ? 5'000 : 25'000;
+
+    for (const SchedulerMode schedulerMode : { SchedulerMode::WorkStealing, SchedulerMode::SharedQueue })
+    {
+        std::cerr << "[Benchmark] Mixed (" << GetSchedulerName(schedulerMode) << ")\n";
+        WorkerPool pool(MakeConfig(options.threads, schedulerMode));
+
+        const auto start = std::chrono::steady_clock::now();
+        for (int job = 0; job < numJobs; job++)
+        {
+            const uint64_t work = job % LongJobInterval == 0 ? LongJobWork : ShortJobWork;
+            pool.AddJob([work]()
+            {
+                DoWork(work);
+            });
+        }
+        pool.WaitForCompletion();
+        const double seconds = GetSecondsSince(start);
+
+        const WorkerPoolStats stats = pool.GetStats();
+        const LaneStats& lane = stats.lanes[static_cast<size_t>(JobPriority::Normal)];
+
+        BenchmarkResult& result = results.emplace_back();
+        result.benchmark = "mixed";
+        result.variant = GetSchedulerName(schedulerMode);
+        result.threads = options.threads;
+        result.metrics = { { "jobs", static_cast<double>(numJobs) }, { "longJobs", static_cast<double>((numJobs + LongJobInterval - 1) / LongJobInterval) },
+                           { "seconds", seconds }, { "jobsPerSecond", numJobs / seconds } };
+        AddLatencyMetrics(result, "queueWait", lane.queueWait);
+        AddLatencyMetrics(result, "execution", lane.execution);
+    }
+}
+
+/**
+ * @brief Fan-out/fan-in: each round submits FanOut tasks and a task depending on all of them, then waits for it.
+ *
+ * The round time covers the whole dependency graph: task creation, scheduling of the children, and the
+ * fan-in task being queued by the last child to complete.
+ */
+void RunFanOutBenchmark(const BenchmarkOptions& options, std::vector<BenchmarkResult>& results)
+{
+    constexpr int FanOut = 256;
+    constexpr uint64_t ChildWork = 1'000;
+    const int numRounds = options.quick ? 50 : 500;
+
+    for (const SchedulerMode schedulerMode : { SchedulerMode::WorkStealing, SchedulerMode::SharedQueue })
+    {
+        std::cerr << "[Benchmark] Fan-out/fan-in (" << GetSchedulerName(schedulerMode) << ")\n";
+        WorkerPool pool(MakeConfig(options.threads, schedulerMode));
+        LatencyHistogram roundTimes;
+        std::vector<TaskDependency> children;
+        children.reserve(FanOut);
+
+        const auto start = std::chrono::steady_clock::now();
+        for (int round = 0; round < numRounds; round++)
+        {
+            const auto roundStart = std::chrono::steady_clock::now();
+            children.clear();
+            for (int child = 0; child < FanOut; child++)
+            {
+                children.emplace_back(pool.Submit([]()
+                {
+                    DoWork(ChildWork);
+                }));
+            }
+            pool.Submit([]() {}, children).Wait();
+            roundTimes.Record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - roundStart).count()));
+        }
+        const double seconds = GetSecondsSince(start);
+
+        BenchmarkResult& result = results.emplace_back();
+        result.benchmark = "fanOutFanIn";
+        result.variant = GetSchedulerName(schedulerMode);
+        result.threads = options.threads;
+        result.metrics = { { "rounds", static_cast<double>(numRounds) }, { "fanOut", static_cast<double>(FanOut) }, { "seconds", seconds },
+                           { "roundsPerSecond", numRounds / seconds } };
+        AddLatencyMetrics(result, "round", roundTimes.Summarize());
+    }
+}
+
+/**
+ * @brief Strong scaling: the same CPU-bound batch run with 1, 2, 4... up to the requested number of workers.
+ *
+ * Speedup and efficiency are relative to the single-worker run.
+ */
+void RunScalingBenchmark(const BenchmarkOptions& options, std::vector<BenchmarkResult>& results)
+{
+    constexpr uint64_t JobWork = 20'000;
+    const int numJobs = options.quick ? 1'024 : 8'192;
+
+    std::vector<uint32_t> threadCounts;
+    for (uint32_t threads = 1; threads < options.threads; threads *= 2)
+    {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(options.threads);
+
+    for (const SchedulerMode schedulerMode : { SchedulerMode::WorkStealing, SchedulerMode::SharedQueue })
+    {
+        double singleThreadSeconds = 0.0;
+        for (const uint32_t threads : threadCounts)
+        {
+            std::cerr << "[Benchmark] Scaling (" << GetSchedulerName(schedulerMode) << ", " << threads << " threads)\n";
+            WorkerPool pool(MakeConfig(threads, schedulerMode));
+
+            const auto start = std::chrono::steady_clock::now();
+            pool.AddJobs(static_cast<size_t>(numJobs), [](size_t)
+            {
+                return []()
+                {
+                    DoWork(JobWork);
+                };
+            });
+            pool.WaitForCompletion();
+            const double seconds = GetSecondsSince(start);
+            if (threads == 1)
+            {
+                singleThreadSeconds = seconds;
+            }
+
+            const double speedup = singleThreadSeconds / seconds;
+            BenchmarkResult& result = results.emplace_back();
+            result.benchmark = "scaling";
+            result.variant = GetSchedulerName(schedulerMode);
+            result.threads = threads;
+            result.metrics = { { "jobs", static_cast<double>(numJobs) }, { "seconds", seconds }, { "jobsPerSecond", numJobs / seconds },
+                               { "speedup", speedup }, { "efficiency", speedup / threads } };
+        }
+    }
+}
+
+/**
+ * @brief Periodic timer recovery: a periodic job must keep firing after one of its runs was dropped unrun.
+ *
+ * Every worker is held on a blocking job, so the periodic run expires into the queue, where ClearAllJobs drops
+ * it. The workers are then released: runsAfterClear must be above 0 (recovered = 1), otherwise the timer was left
+ * waiting for the dropped run.
+ */
+void RunPeriodicRecoveryBenchmark(const BenchmarkOptions& options, std::vector<BenchmarkResult>& results)
+{
+    constexpr std::chrono::milliseconds Period(5);
+    constexpr int ObservedPeriods = 20;
+
+    std::cerr << "[Benchmark] Periodic recovery after ClearAllJobs\n";
+    WorkerPool pool(MakeConfig(options.threads, SchedulerMode::WorkStealing));
+
+    std::atomic<uint32_t> blockedWorkers{ 0 };
+    std::atomic<bool> released{ false };
+    for (uint32_t worker = 0; worker < options.threads; worker++)
+    {
+        pool.AddJob([&blockedWorkers, &released]()
+        {
+            blockedWorkers++;
+            while (!released.load())
+            {
+                std::this_thread::yield();
+            }
+        });
+    }
+    while (blockedWorkers.load() < options.threads)
+    {
+        std::this_thread::yield();
+    }
+
+    std::atomic<int> runs{ 0 };
+    const TimerId timer = pool.AddPeriodicJob(Period, [&runs]()
+    {
+        runs++;
+    });
+
+    // A run expires into the queue behind the blocked workers and is dropped before it can start
+    std::this_thread::sleep_for(Period * 4);
+    const int droppedRuns = pool.GetPendingJobsCount();
+    pool.ClearAllJobs();
+    const int runsBeforeClear = runs.load();
+    released = true;
+
+    std::this_thread::sleep_for(Period * ObservedPeriods);
+    pool.CancelTimer(timer);
+    pool.WaitForCompletion();
+    const int runsAfterClear = runs.load() - runsBeforeClear;
+    if (runsAfterClear == 0)
+    {
+        std::cerr << "[Benchmark] Periodic job stopped firing after ClearAllJobs\n";
+    }
+
+    BenchmarkResult& result = results.emplace_back();
+    result.benchmark = "periodicRecovery";
+    result.variant = GetSchedulerName(SchedulerMode::WorkStealing);
+    result.threads = options.threads;
+    result.metrics = { { "periodNs", static_cast<double>(std::chrono::nanoseconds(Period).count()) }, { "droppedRuns", static_cast<double>(droppedRuns) },
+                       { "runsAfterClear", static_cast<double>(runsAfterClear) }, { "recovered", runsAfterClear > 0 ? 1.0 : 0.0 } };
+}
+
+/**
+ * @brief Writes the results as CSV, one metric per row.
+ */
+void WriteCsv(std::ostream& out, const std::vector<BenchmarkResult>& results)
+{
+    out << std::setprecision(12) << "benchmark,variant,threads,metric,value\n";
+    for (const BenchmarkResult& result : results)
+    {
+        for (const auto& [metric, value] : result.metrics)
+        {
+            out << result.benchmark << "," << result.variant << "," << result.threads << "," << metric << "," << value << "\n";
+        }
+    }
+}
+
+/**
+ * @brief Writes the results as a JSON array, one object per result with its metrics in a nested object.
+ */
+void WriteJson(std::ostream& out, const std::vector<BenchmarkResult>& results)
+{
+    out << std::setprecision(12) << "[\n";
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const BenchmarkResult& result = results[i];
+        out << "  { \"benchmark\": \"" << result.benchmark << "\", \"variant\": \"" << result.variant << "\", \"threads\": " << result.threads
+            << ", \"metrics\": { ";
+        for (size_t metric = 0; metric < result.metrics.size(); metric++)
+        {
+            out << (metric > 0 ? ", " : "") << "\"" << result.metrics[metric].first << "\": " << result.metrics[metric].second;
+        }
+        out << " } }" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "]\n";
+}
+
+/**
+ * @brief Prints the command line usage.
+ */
+void PrintUsage(const char* program)
+{
+    std::cerr << "Usage: " << program << " [--format csv|json] [--threads N] [--quick] [--only NAME]\n"
+              << "  --format   Output format on stdout (default: csv)\n"
+              << "  --threads  Worker count, and the top of the scaling run (default: hardware concurrency)\n"
+              << "  --quick    Smaller job counts, for a fast smoke run\n"
+              << "  --only     Run a single benchmark: throughput, latency, mixed, fanOutFanIn, scaling or periodicRecovery\n";
+}
+
+/**
+ * @brief Headless WorkerPool benchmark suite.
+ *
+ * Runs the throughput, latency, mixed, fan-out/fan-in, scaling and periodic recovery benchmarks and writes their results to stdout
+ * as CSV or JSON; progress goes to stderr. Returns 1 on a bad command line.
+ */
+int main(int argc, char** argv)
+{
+    BenchmarkOptions options;
+    std::string only;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string argument = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (argument == "--format" && hasValue)
+        {
+            const std::string format = argv[++i];
+            if (format != "csv" && format != "json")
+            {
+                PrintUsage(argv[0]);
+                return 1;
+            }
+            options.json = format == "json";
+        }
+        else if (argument == "--threads" && hasValue)
+        {
+            std::istringstream value(argv[++i]);
+            if (!(value >> options.threads) || options.threads == 0)
+            {
+                PrintUsage(argv[0]);
+                return 1;
+            }
+        }
+        else if (argument == "--quick")
+        {
+            options.quick = true;
+        }
+        else if (argument == "--only" && hasValue)
+        {
+            only = argv[++i];
+        }
+        else
+        {
+            PrintUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    struct Benchmark
+    {
+        const char* name;
+        void (*run)(const BenchmarkOptions&, std::vector<BenchmarkResult>&);
+    };
+    const Benchmark benchmarks[] = {
+        { "throughput", RunThroughputBenchmark },
+        { "latency", RunLatencyBenchmark },
+        { "mixed", RunMixedBenchmark },
+        { "fanOutFanIn", RunFanOutBenchmark },
+        { "scaling", RunScalingBenchmark },
+        { "periodicRecovery", RunPeriodicRecoveryBenchmark }
+    };
+
+    std::vector<BenchmarkResult> results;
+    bool found = only.empty();
+    for (const Benchmark& benchmark : benchmarks)
+    {
+        if (only.empty() || only == benchmark.name)
+        {
+            benchmark.run(options, results);
+            found = true;
+        }
+    }
+
+    if (!found)
+    {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    if (options.json)
+    {
+        WriteJson(std::cout, results);
+    }
+    else
+    {
+        WriteCsv(std::cout, results);
+    }
+    return 0;
+}
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+/**
+ * @brief Bounded lock-free multi-producer/multi-consumer ring buffer
+ *
+ * Classic sequence-numbered ring (D. Vyukov): every cell carries a sequence number
+ * telling producers and consumers whether it is free or filled for their lap, so a
+ * push or a pop is one CAS on the shared position plus one release store on the cell.
+ * The two positions and every cell live on their own cache line to avoid false sharing
+ * between producers, consumers and neighbouring cells.
+ */
+template <typename T>
+class BoundedMPMCQueue
+{
+public:
+
+    //////// CONSTANTS ////////
+    static constexpr size_t CacheLineSize = 64;
+
+    //////// CONSTRUCTOR ////////
+    explicit BoundedMPMCQueue(size_t requestedCapacity)
+    {
+        size_t capacity = 2;
+        while (capacity < requestedCapacity)
+        {
+            capacity *= 2;
+        }
+
+        mask = capacity - 1;
+        cells = std::make_unique<Cell[]>(capacity);
+        for (size_t i = 0; i < capacity; i++)
+        {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+	//////// DELETED METHODS ////////
+    BoundedMPMCQueue(const BoundedMPMCQueue&) = delete;
+    BoundedMPMCQueue& operator=(const BoundedMPMCQueue&) = delete;
+
+	//////// METHODS ////////
+    /**
+     * @brief Pushes an item, moving from it only on success
+     * @return false if the queue is full
+     */
+    bool TryPush(T& item)
+    {
+        size_t position = enqueuePosition.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+
+        for (;;)
+        {
+            cell = &cells[position & mask];
+            const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+            if (difference == 0)
+            {
+                if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                return false;
+            }
+            else
+            {
+                position = enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->data = std::move(item);
+        cell->sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Pops the oldest item
+     * @return false if the queue is empty
+     */
+    bool TryPop(T& out)
+    {
+        size_t position = dequeuePosition.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+
+        for (;;)
+        {
+            cell = &cells[position & mask];
+            const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+
+            if (difference == 0)
+            {
+                if (dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                return false;
+            }
+            else
+            {
+                position = dequeuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        out = std::move(cell->data);
+        cell->sequence.store(position + mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    //// Helpers
+    /**
+     * @brief Approximate number of items (exact when no push or pop is in progress)
+     */
+    [[nodiscard]] size_t Size() const
+    {
+        const size_t enqueued = enqueuePosition.load(std::memory_order_acquire);
+        const size_t dequeued = dequeuePosition.load(std::memory_order_acquire);
+        return enqueued > dequeued ? enqueued - dequeued : 0;
+    }
+
+    [[nodiscard]] size_t Capacity() const { return mask + 1; }
+
+private:
+
+    //////// STRUCTS ////////
+    struct alignas(CacheLineSize) Cell
+    {
+        std::atomic<size_t> sequence{ 0 };
+        T data{};
+    };
+
+    //////// FIELDS ////////
+    alignas(CacheLineSize) std::atomic<size_t> enqueuePosition{ 0 };
+    alignas(CacheLineSize) std::atomic<size_t> dequeuePosition{ 0 };
+    alignas(CacheLineSize) std::unique_ptr<Cell[]> cells;
+    size_t mask = 0;
+};
@@ -0,0 +1,227 @@
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+
+template <typename T>
+class CoTask;
+
+/**
+ * @brief Result slot of a CoTask promise (value or exception)
+ */
+template <typename T>
+class CoTaskResult
+{
+public:
+
+	//////// METHODS ////////
+    template <typename U>
+    void return_value(U&& value)
+    {
+        result.emplace(std::forward<U>(value));
+    }
+
+    void unhandled_exception()
+    {
+        exception = std::current_exception();
+    }
+
+    T TakeResult()
+    {
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+        return std::move(*result);
+    }
+
+private:
+
+    //////// FIELDS ////////
+    std::optional<T> result;
+    std::exception_ptr exception;
+};
+
+template <>
+class CoTaskResult<void>
+{
+public:
+
+	//////// METHODS ////////
+    void return_void()
+    {
+    }
+
+    void unhandled_exception()
+    {
+        exception = std::current_exception();
+    }
+
+    void TakeResult()
+    {
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+
+private:
+
+    //////// FIELDS ////////
+    std::exception_ptr exception;
+};
+
+/**
+ * @brief Lazy coroutine returning a T, to be co_awaited or started with WorkerPool::Spawn
+ *
+ * The body does not run until the task is awaited. Awaiting a CoTask transfers control
+ * straight into it on the same thread (symmetric transfer, no job is queued), and the
+ * awaiting coroutine resumes as soon as the task returns. The body gives its worker back
+ * to the pool whenever it suspends, e.g. on co_await pool.Delay(...), co_await pool.Schedule()
+ * or co_await taskHandle, so thousands of waiting coroutines only need a few threads.
+ *
+ * CoTask<int> Compute(WorkerPool& pool)
+ * {
+ *     co_await pool.Delay(std::chrono::milliseconds(100));
+ *     co_return 42;
+ * }
+ */
+template <typename T = void>
+class CoTask
+{
+public:
+
+    //////// TYPES ////////
+    class promise_type : public CoTaskResult<T>
+    {
+    public:
+
+        CoTask get_return_object()
+        {
+            return CoTask(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        /**
+         * @brief Resumes the awaiting coroutine, if any, once the body has returned
+         */
+        auto final_suspend() noexcept
+        {
+            struct FinalAwaiter
+            {
+                bool await_ready() noexcept { return false; }
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept
+                {
+                    std::coroutine_handle<> continuation = handle.promise().continuation;
+                    return continuation ? continuation : std::noop_coroutine();
+                }
+                void await_resume() noexcept {}
+            };
+            return FinalAwaiter{};
+        }
+
+    private:
+
+        std::coroutine_handle<> continuation;
+
+        friend class CoTask;
+    };
+
+    using Handle = std::coroutine_handle<promise_type>;
+
+    //////// CONSTRUCTOR ////////
+    CoTask() = default;
+    explicit CoTask(Handle handle) : handle(handle) {}
+    CoTask(CoTask&& other) noexcept : handle(std::exchange(other.handle, {})) {}
+    ~CoTask() { Destroy(); }
+
+    CoTask& operator=(CoTask&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Destroy();
+            handle = std::exchange(other.handle, {});
+        }
+        return *this;
+    }
+
+	//////// DELETED METHODS ////////
+    CoTask(const CoTask&) = delete;
+    CoTask& operator=(const CoTask&) = delete;
+
+	//////// METHODS ////////
+    [[nodiscard]] bool IsValid() const { return static_cast<bool>(handle); }
+
+    /**
+     * @brief Starts the task and suspends the caller until it returns; yields its result or rethrows its exception
+     */
+    auto operator co_await() && noexcept
+    {
+        struct Awaiter
+        {
+            Handle handle;
+
+            bool await_ready() noexcept { return !handle || handle.done(); }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+            {
+                handle.promise().continuation = awaiting;
+                return handle;
+            }
+            T await_resume() { return handle.promise().TakeResult(); }
+        };
+        return Awaiter{ handle };
+    }
+
+private:
+
+	//////// METHODS ////////
+    void Destroy()
+    {
+        if (handle)
+        {
+            handle.destroy();
+            handle = {};
+        }
+    }
+
+    //////// FIELDS ////////
+    Handle handle;
+};
+
+/**
+ * @brief Fire-and-forget coroutine used by WorkerPool::Spawn to drive a CoTask
+ *
+ * Starts suspended so the pool can hand its first resumption to a worker, and frees
+ * its own frame when it finishes.
+ */
+class DetachedCoroutine
+{
+public:
+
+    //////// TYPES ////////
+    struct promise_type
+    {
+        DetachedCoroutine get_return_object() { return DetachedCoroutine(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+
+    //////// CONSTRUCTOR ////////
+    explicit DetachedCoroutine(std::coroutine_handle<promise_type> handle) : handle(handle) {}
+
+	//////// METHODS ////////
+    [[nodiscard]] std::coroutine_handle<> GetHandle() const { return handle; }
+
+private:
+
+    //////// FIELDS ////////
+    std::coroutine_handle<promise_type> handle;
+};
@@ -0,0 +1,275 @@
+#include "Job.h"
+#include "JobGroup.h"
+
+#include <atomic>
+#include <mutex>
+
+namespace
+{
+    //// Size classes are MinBlockSize, 2 * MinBlockSize, ..., MaxBlockSize
+    constexpr size_t SizeClassCount = 6;
+    static_assert((JobStorage::MinBlockSize << (SizeClassCount - 1)) == JobStorage::MaxBlockSize);
+
+    //// Blocks exchanged with the global list at once, and blocks a thread may keep for itself
+    constexpr size_t TransferBatchSize = 64;
+    constexpr size_t MaxCachedBlocks = 2 * TransferBatchSize;
+
+    std::atomic<uint64_t> heapAllocationCount{ 0 };
+
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    /**
+     * @brief Free blocks of one size class shared by every thread
+     *
+     * Never destroyed: blocks may still be released by threads that outlive static destruction.
+     */
+    struct GlobalFreeList
+    {
+        std::mutex listMutex;
+        FreeBlock* head = nullptr;
+    };
+
+    GlobalFreeList globalFreeLists[SizeClassCount];
+
+    /**
+     * @brief Free blocks owned by the current thread, returned to the global lists at thread exit
+     */
+    struct ThreadCache
+    {
+        FreeBlock* heads[SizeClassCount] = {};
+        size_t counts[SizeClassCount] = {};
+
+        ~ThreadCache()
+        {
+            for (size_t sizeClass = 0; sizeClass < SizeClassCount; sizeClass++)
+            {
+                if (counts[sizeClass] > 0)
+                {
+                    Flush(sizeClass, counts[sizeClass]);
+                }
+            }
+        }
+
+        /**
+         * @brief Moves count cached blocks (count <= counts[sizeClass]) of a size class to the global list under one lock
+         */
+        void Flush(size_t sizeClass, size_t count)
+        {
+            FreeBlock* first = heads[sizeClass];
+            FreeBlock* last = first;
+            for (size_t i = 1; i < count; i++)
+            {
+                last = last->next;
+            }
+
+            heads[sizeClass] = last->next;
+            counts[sizeClass] -= count;
+
+            GlobalFreeList& global = globalFreeLists[sizeClass];
+            std::scoped_lock lock(global.listMutex);
+            last->next = global.head;
+            global.head = first;
+        }
+
+        /**
+         * @brief Takes up to a batch of blocks of a size class from the global list under one lock
+         */
+        void Refill(size_t sizeClass)
+        {
+            GlobalFreeList& global = globalFreeLists[sizeClass];
+            std::scoped_lock lock(global.listMutex);
+
+            while (global.head != nullptr && counts[sizeClass] < TransferBatchSize)
+            {
+                FreeBlock* block = global.head;
+                global.head = block->next;
+                block->next = heads[sizeClass];
+                heads[sizeClass] = block;
+                counts[sizeClass]++;
+            }
+        }
+    };
+
+    thread_local ThreadCache threadCache;
+
+    size_t GetSizeClass(size_t blockSize)
+    {
+        size_t sizeClass = 0;
+        while ((JobStorage::MinBlockSize << sizeClass) < blockSize)
+        {
+            sizeClass++;
+        }
+        return sizeClass;
+    }
+}
+
+/**
+* @brief Allocates storage for a job callable too large for the inline buffer
+* @param size Size of the callable in bytes
+* @param outBlockSize Size of the returned block, to pass back to Release
+* @return Block aligned for any standard type
+*/
+void* JobStorage::Allocate(size_t size, size_t& outBlockSize)
+{
+    if (size > MaxBlockSize)
+    {
+        heapAllocationCount++;
+        outBlockSize = size;
+        return ::operator new(size);
+    }
+
+    const size_t sizeClass = GetSizeClass(size);
+    outBlockSize = MinBlockSize << sizeClass;
+
+    if (threadCache.heads[sizeClass] == nullptr)
+    {
+        threadCache.Refill(sizeClass);
+    }
+
+    if (FreeBlock* block = threadCache.heads[sizeClass])
+    {
+        threadCache.heads[sizeClass] = block->next;
+        threadCache.counts[sizeClass]--;
+        return block;
+    }
+
+    heapAllocationCount++;
+    return ::operator new(outBlockSize);
+}
+
+/**
+* @brief Gives a block back for reuse
+* @param block Block returned by Allocate
+* @param blockSize Block size returned by Allocate
+*/
+void JobStorage::Release(void* block, size_t blockSize)
+{
+    if (blockSize > MaxBlockSize)
+    {
+        ::operator delete(block);
+        return;
+    }
+
+    const size_t sizeClass = GetSizeClass(blockSize);
+    FreeBlock* freeBlock = static_cast<FreeBlock*>(block);
+    freeBlock->next = threadCache.heads[sizeClass];
+    threadCache.heads[sizeClass] = freeBlock;
+
+    if (++threadCache.counts[sizeClass] > MaxCachedBlocks)
+    {
+        threadCache.Flush(sizeClass, TransferBatchSize);
+    }
+}
+
+/**
+* @brief Get the number of job storage blocks taken from the heap since startup
+*
+* Stays flat once the free lists are warm; a growing value means job captures
+* are being allocated in steady state.
+*/
+uint64_t JobStorage::GetHeapAllocationCount()
+{
+    return heapAllocationCount;
+}
+
+/**
+* @brief Destroys the stored callable and releases its block
+*/
+Job::~Job()
+{
+    Reset();
+}
+
+/**
+* @brief Move constructor, leaves the source empty
+*/
+Job::Job(Job&& other) noexcept
+{
+    MoveFrom(other);
+}
+
+/**
+* @brief Move assignment, destroys the current callable and leaves the source empty
+*/
+Job& Job::operator=(Job&& other) noexcept
+{
+    if (this != &other)
+    {
+        Reset();
+        MoveFrom(other);
+    }
+    return *this;
+}
+
+/**
+* @brief Runs the stored callable
+*/
+void Job::operator()()
+{
+    operations->invoke(target);
+}
+
+/**
+* @brief Destroys the stored callable, leaving the job empty
+*
+* A grouped job then leaves its group, so a group waiter never sees the captures still alive.
+*/
+void Job::Reset()
+{
+    if (operations != nullptr)
+    {
+        operations->destroy(target);
+        if (blockSize != 0)
+        {
+            JobStorage::Release(target, blockSize);
+        }
+
+        operations = nullptr;
+        target = nullptr;
+        blockSize = 0;
+    }
+
+    if (group)
+    {
+        group->RemoveJob(id);
+        group.reset();
+    }
+}
+
+/**
+* @brief Takes the callable of another (empty or reset) job
+*
+* Inline callables are relocated into this job's buffer; pooled ones only change owner.
+*/
+void Job::MoveFrom(Job& other)
+{
+    id = other.id;
+    priority = other.priority;
+    enqueueTime = other.enqueueTime;
+    group = std::move(other.group);
+
+    if (other.operations == nullptr)
+    {
+        return;
+    }
+
+    if (other.blockSize == 0)
+    {
+        other.operations->relocate(inlineStorage, other.target);
+        target = inlineStorage;
+    }
+    else
+    {
+        target = other.target;
+    }
+
+    operations = other.operations;
+    blockSize = other.blockSize;
+
+    other.operations = nullptr;
+    other.target = nullptr;
+    other.blockSize = 0;
+}
@@ -0,0 +1,143 @@
+#pragma once
+
+#include "WorkerPoolConfig.h"
+
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <memory>
+#include <new>
+
+class JobGroupState;
+
+/**
+ * @brief Recycling allocator for job captures that do not fit in a Job's inline buffer
+ *
+ * Blocks are grouped in power-of-two size classes. Each thread keeps a small cache of
+ * free blocks per class and exchanges batches with a global list when its cache runs
+ * dry or overflows, which covers the usual pattern of one thread submitting and another
+ * one destroying jobs. The heap is only hit when no recycled block exists, so once the
+ * caches are warm a submit/execute cycle performs no heap allocation.
+ */
+class JobStorage
+{
+public:
+
+    //////// CONSTANTS ////////
+    static constexpr size_t MinBlockSize = 128;
+    static constexpr size_t MaxBlockSize = 4096;
+
+	//////// STATIC METHODS ////////
+    static void* Allocate(size_t size, size_t& outBlockSize);
+    static void Release(void* block, size_t blockSize);
+
+    //// Stats
+    [[nodiscard]] static uint64_t GetHeapAllocationCount();
+};
+
+/**
+ * @brief Move-only, type-erased job
+ *
+ * Callables up to InlineCapacity bytes are stored in place, larger ones in a block
+ * from JobStorage. Unlike std::function, a Job is never copied: it is built once at
+ * submission and moved through the queues to the worker that runs it. Move-only
+ * captures (std::unique_ptr, std::promise...) are therefore accepted.
+ *
+ * A job added to a JobGroup keeps a reference to it and leaves the group when it is destroyed
+ * (after running, or unrun if it was cancelled or dropped).
+ */
+class Job
+{
+public:
+
+    //////// CONSTANTS ////////
+    static constexpr size_t InlineCapacity = 64;
+
+    //////// CONSTRUCTOR ////////
+    Job() = default;
+    ~Job();
+
+    template <typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, Job>>>
+    Job(F&& function)
+    {
+        using Callable = std::decay_t<F>;
+        static_assert(alignof(Callable) <= alignof(std::max_align_t), "Over-aligned job captures are not supported");
+
+        if constexpr (sizeof(Callable) <= InlineCapacity && std::is_nothrow_move_constructible_v<Callable>)
+        {
+            target = ::new (static_cast<void*>(inlineStorage)) Callable(std::forward<F>(function));
+        }
+        else
+        {
+            void* block = JobStorage::Allocate(sizeof(Callable), blockSize);
+            target = ::new (block) Callable(std::forward<F>(function));
+        }
+        operations = &OperationsFor<Callable>;
+    }
+
+    Job(Job&& other) noexcept;
+    Job& operator=(Job&& other) noexcept;
+
+	//////// DELETED METHODS ////////
+    Job(const Job&) = delete;
+    Job& operator=(const Job&) = delete;
+
+	//////// METHODS ////////
+    void operator()();
+    explicit operator bool() const { return operations != nullptr; }
+
+    //// Helpers
+    [[nodiscard]] uint64_t GetId() const { return id; }
+    void SetId(uint64_t jobId) { id = jobId; }
+    [[nodiscard]] JobPriority GetPriority() const { return priority; }
+    void SetPriority(JobPriority jobPriority) { priority = jobPriority; }
+    [[nodiscard]] int64_t GetEnqueueTime() const { return enqueueTime; }
+    void SetEnqueueTime(int64_t timeNanoseconds) { enqueueTime = timeNanoseconds; }
+    [[nodiscard]] bool IsInline() const { return operations != nullptr && blockSize == 0; }
+    [[nodiscard]] const std::shared_ptr<JobGroupState>& GetGroup() const { return group; }
+    void SetGroup(std::shared_ptr<JobGroupState> jobGroup) { group = std::move(jobGroup); }
+
+private:
+
+    //////// STRUCTS ////////
+
+    /**
+     * @brief Type-specific operations of the stored callable
+     *
+     * relocate is only used for inline callables: it move-constructs the callable into
+     * another inline buffer and destroys the source. Out-of-line callables move by pointer.
+     */
+    struct Operations
+    {
+        void (*invoke)(void* callable);
+        void (*relocate)(void* destination, void* source);
+        void (*destroy)(void* callable);
+    };
+
+    template <typename Callable>
+    static constexpr Operations OperationsFor =
+    {
+        [](void* callable) { (*static_cast<Callable*>(callable))(); },
+        [](void* destination, void* source)
+        {
+            ::new (destination) Callable(std::move(*static_cast<Callable*>(source)));
+            static_cast<Callable*>(source)->~Callable();
+        },
+        [](void* callable) { static_cast<Callable*>(callable)->~Callable(); }
+    };
+
+	//////// METHODS ////////
+    void Reset();
+    void MoveFrom(Job& other);
+
+    //////// FIELDS ////////
+    alignas(std::max_align_t) unsigned char inlineStorage[InlineCapacity];
+    const Operations* operations = nullptr;
+    void* target = nullptr;
+    size_t blockSize = 0;
+    std::shared_ptr<JobGroupState> group;
+    int64_t enqueueTime = 0;
+    uint64_t id = 0;
+    JobPriority priority = JobPriority::Normal;
+};
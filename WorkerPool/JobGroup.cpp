@@ -0,0 +1,193 @@
+#include "JobGroup.h"
+
+/**
+ * @brief Construct a new Job Group State:: Job Group State object
+ *
+ * @param id Identifier of the group, used in logs
+ */
+JobGroupState::JobGroupState(int id) : id(id)
+{
+}
+
+/**
+ * @brief Registers jobs firstJobId to firstJobId + count - 1 as pending, before they are queued.
+ */
+void JobGroupState::AddJobs(uint64_t firstJobId, size_t count)
+{
+    std::scoped_lock lock(groupMutex);
+    for (size_t i = 0; i < count; i++)
+    {
+        pendingJobs.emplace(firstJobId + i, PendingJob{});
+    }
+}
+
+/**
+ * @brief Removes a job that was destroyed (run, skipped or dropped), waking the waiters if it was the last one.
+ */
+void JobGroupState::RemoveJob(uint64_t jobId)
+{
+    bool lastJob = false;
+    {
+        std::scoped_lock lock(groupMutex);
+        lastJob = pendingJobs.erase(jobId) != 0 && pendingJobs.empty();
+    }
+
+    if (lastJob)
+    {
+        completedCondition.notify_all();
+    }
+}
+
+/**
+ * @brief Called by a worker before it runs a job of the group.
+ *
+ * @param jobStopSource Stop source of the run, requested by CancelJob until the job is removed
+ * @return false if the job or the group was cancelled: the job must be skipped
+ */
+bool JobGroupState::BeginJob(uint64_t jobId, std::stop_source* jobStopSource)
+{
+    std::scoped_lock lock(groupMutex);
+    auto pendingJob = pendingJobs.find(jobId);
+    if (pendingJob == pendingJobs.end() || pendingJob->second.cancelled || stopSource.stop_requested())
+    {
+        return false;
+    }
+
+    pendingJob->second.runningStopSource = jobStopSource;
+    return true;
+}
+
+/**
+ * @brief Cancels one job of the group.
+ *
+ * A queued job is skipped when a worker pops it; a running job sees a stop request on its token.
+ *
+ * @return false if the job is not pending in this group
+ */
+bool JobGroupState::CancelJob(uint64_t jobId)
+{
+    std::scoped_lock lock(groupMutex);
+    auto pendingJob = pendingJobs.find(jobId);
+    if (pendingJob == pendingJobs.end())
+    {
+        return false;
+    }
+
+    pendingJob->second.cancelled = true;
+    if (pendingJob->second.runningStopSource != nullptr)
+    {
+        pendingJob->second.runningStopSource->request_stop();
+    }
+    return true;
+}
+
+/**
+ * @brief Cancels the group: queued jobs are skipped and running jobs see a stop request on their token.
+ *
+ * @return Number of jobs that were pending (queued or running)
+ */
+size_t JobGroupState::Cancel()
+{
+    stopSource.request_stop();
+
+    std::scoped_lock lock(groupMutex);
+    return pendingJobs.size();
+}
+
+/**
+ * @brief Blocks until every job of the group has been removed.
+ */
+void JobGroupState::Wait() const
+{
+    std::unique_lock lock(groupMutex);
+    completedCondition.wait(lock, [this]
+    {
+        return pendingJobs.empty();
+    });
+}
+
+/**
+ * @brief Blocks until every job of the group has been removed or the timeout expires.
+ *
+ * @return true if the group is done, false if the timeout expired first
+ */
+bool JobGroupState::Wait(std::chrono::milliseconds timeout) const
+{
+    std::unique_lock lock(groupMutex);
+    return completedCondition.wait_for(lock, timeout, [this]
+    {
+        return pendingJobs.empty();
+    });
+}
+
+/**
+ * @brief Get the identifier of the group.
+ */
+int JobGroupState::GetId() const
+{
+    return id;
+}
+
+/**
+ * @brief Get the number of jobs of the group that are queued or running.
+ */
+size_t JobGroupState::GetPendingCount() const
+{
+    std::scoped_lock lock(groupMutex);
+    return pendingJobs.size();
+}
+
+/**
+ * @brief Checks whether the group was cancelled.
+ */
+bool JobGroupState::IsCancelled() const
+{
+    return stopSource.stop_requested();
+}
+
+/**
+ * @brief Get the token stopped when the group is cancelled.
+ */
+std::stop_token JobGroupState::GetStopToken() const
+{
+    return stopSource.get_token();
+}
+
+/**
+ * @brief Construct a new Job Group:: Job Group object
+ */
+JobGroup::JobGroup(std::shared_ptr<JobGroupState> state) : state(std::move(state))
+{
+}
+
+/**
+ * @brief Checks whether the handle refers to a group.
+ */
+bool JobGroup::IsValid() const
+{
+    return state != nullptr;
+}
+
+/**
+ * @brief Get the identifier of the group, -1 for an empty handle.
+ */
+int JobGroup::GetId() const
+{
+    return state ? state->GetId() : -1;
+}
+
+/**
+ * @brief Get the number of jobs of the group that are queued or running.
+ */
+size_t JobGroup::GetPendingCount() const
+{
+    return state ? state->GetPendingCount() : 0;
+}
+
+/**
+ * @brief Checks whether the group was cancelled.
+ */
+bool JobGroup::IsCancelled() const
+{
+    return state && state->IsCancelled();
+}
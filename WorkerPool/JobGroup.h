@@ -0,0 +1,101 @@
+#pragma once
+
+#include <condition_variable>
+#include <unordered_map>
+#include <stop_token>
+#include <cstddef>
+#include <cstdint>
+#include <chrono>
+#include <memory>
+#include <mutex>
+
+/**
+ * @brief Shared state of a job group: its pending jobs and its cancellation
+ *
+ * A job joins its group when it is queued and leaves it when the Job is destroyed, whether
+ * it ran, was skipped after a cancellation, was rejected or was cleared from a queue, so the
+ * pending count cannot leak. A worker asks the group before starting a job (BeginJob) and
+ * registers the job's stop source while it runs, which is how CancelJob reaches a running job.
+ * Cancelling the whole group requests a stop on the group's own source, which running jobs
+ * are subscribed to. A cancelled group stays cancelled: jobs added to it later are skipped.
+ */
+class JobGroupState
+{
+public:
+
+    //////// CONSTRUCTOR ////////
+    explicit JobGroupState(int id);
+
+	//////// DELETED METHODS ////////
+    JobGroupState(const JobGroupState&) = delete;
+    JobGroupState& operator=(const JobGroupState&) = delete;
+
+	//////// METHODS ////////
+    //// Membership
+    void AddJobs(uint64_t firstJobId, size_t count);
+    void RemoveJob(uint64_t jobId);
+
+    //// Execution
+    bool BeginJob(uint64_t jobId, std::stop_source* jobStopSource);
+
+    //// Cancellation
+    bool CancelJob(uint64_t jobId);
+    size_t Cancel();
+
+    //// Waiting
+    void Wait() const;
+    bool Wait(std::chrono::milliseconds timeout) const;
+
+    //// Helpers
+    [[nodiscard]] int GetId() const;
+    [[nodiscard]] size_t GetPendingCount() const;
+    [[nodiscard]] bool IsCancelled() const;
+    [[nodiscard]] std::stop_token GetStopToken() const;
+
+private:
+
+    //////// STRUCTS ////////
+    struct PendingJob
+    {
+        bool cancelled = false;
+        std::stop_source* runningStopSource = nullptr;
+    };
+
+    //////// FIELDS ////////
+    int id;
+    std::stop_source stopSource;
+    std::unordered_map<uint64_t, PendingJob> pendingJobs;
+    mutable std::mutex groupMutex;
+    mutable std::condition_variable completedCondition;
+};
+
+/**
+ * @brief Handle to a group of jobs created by WorkerPool::CreateGroup
+ *
+ * Copies refer to the same group. A default-constructed handle is not a group: jobs
+ * added with it are ungrouped.
+ */
+class JobGroup
+{
+public:
+
+    //////// CONSTRUCTOR ////////
+    JobGroup() = default;
+
+	//////// METHODS ////////
+    [[nodiscard]] bool IsValid() const;
+    [[nodiscard]] int GetId() const;
+    [[nodiscard]] size_t GetPendingCount() const;
+    [[nodiscard]] bool IsCancelled() const;
+
+private:
+
+    //////// CONSTRUCTOR ////////
+    explicit JobGroup(std::shared_ptr<JobGroupState> state);
+
+    //////// FRIENDS ////////
+    friend class WorkerPool;
+
+    //////// FIELDS ////////
+    std::shared_ptr<JobGroupState> state;
+};
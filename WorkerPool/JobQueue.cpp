@@ -0,0 +1,136 @@
+#include "JobQueue.h"
+
+/**
+ * @brief Creates the lane queue matching the selected backend.
+ * @param backend Queue implementation to use
+ * @param capacity Maximum number of queued jobs (BoundedLockFree only, rounded up to a power of two)
+ */
+std::unique_ptr<JobQueue> JobQueue::Create(QueueBackend backend, size_t capacity)
+{
+    if (backend == QueueBackend::BoundedLockFree)
+    {
+        return std::make_unique<LockFreeJobQueue>(capacity);
+    }
+    return std::make_unique<LockedJobQueue>();
+}
+
+/**
+ * @brief Appends a job, always succeeds.
+ */
+bool LockedJobQueue::TryPush(Job& job)
+{
+    std::scoped_lock lock(queueMutex);
+    jobs.PushBack(std::move(job));
+    return true;
+}
+
+/**
+ * @brief Appends a batch of jobs under one lock acquisition, always pushes them all.
+ */
+size_t LockedJobQueue::TryPushBatch(Job* batch, size_t count)
+{
+    std::scoped_lock lock(queueMutex);
+    for (size_t i = 0; i < count; i++)
+    {
+        jobs.PushBack(std::move(batch[i]));
+    }
+    return count;
+}
+
+/**
+ * @brief Pops the oldest job, if any.
+ */
+bool LockedJobQueue::TryPop(Job& outJob)
+{
+    std::scoped_lock lock(queueMutex);
+    if (jobs.Empty())
+    {
+        return false;
+    }
+
+    outJob = jobs.PopFront();
+    return true;
+}
+
+/**
+ * @brief Drops every queued job.
+ * @return Number of jobs dropped
+ */
+size_t LockedJobQueue::Clear()
+{
+    std::scoped_lock lock(queueMutex);
+    const size_t removed = jobs.Size();
+    jobs.Clear();
+    return removed;
+}
+
+/**
+ * @brief Get the number of queued jobs.
+ */
+size_t LockedJobQueue::Size() const
+{
+    std::scoped_lock lock(queueMutex);
+    return jobs.Size();
+}
+
+/**
+ * @brief Construct a new Lock Free Job Queue:: Lock Free Job Queue object
+ * @param capacity Maximum number of queued jobs, rounded up to a power of two
+ */
+LockFreeJobQueue::LockFreeJobQueue(size_t capacity) : ring(capacity)
+{
+}
+
+/**
+ * @brief Appends a job if the ring has room; the job is left untouched otherwise.
+ */
+bool LockFreeJobQueue::TryPush(Job& job)
+{
+    return ring.TryPush(job);
+}
+
+/**
+ * @brief Appends jobs in order until the ring is full.
+ * @return Number of jobs pushed (the first ones of the batch)
+ */
+size_t LockFreeJobQueue::TryPushBatch(Job* batch, size_t count)
+{
+    size_t pushed = 0;
+    while (pushed < count && ring.TryPush(batch[pushed]))
+    {
+        pushed++;
+    }
+    return pushed;
+}
+
+/**
+ * @brief Pops the oldest job, if any.
+ */
+bool LockFreeJobQueue::TryPop(Job& outJob)
+{
+    return ring.TryPop(outJob);
+}
+
+/**
+ * @brief Drops every queued job.
+ * @return Number of jobs dropped
+ */
+size_t LockFreeJobQueue::Clear()
+{
+    size_t removed = 0;
+    Job dropped;
+    while (ring.TryPop(dropped))
+    {
+        dropped = Job();
+        removed++;
+    }
+    return removed;
+}
+
+/**
+ * @brief Get the approximate number of queued jobs.
+ */
+size_t LockFreeJobQueue::Size() const
+{
+    return ring.Size();
+}
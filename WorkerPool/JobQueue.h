@@ -0,0 +1,84 @@
+#pragma once
+
+#include "BoundedMPMCQueue.h"
+#include "WorkerPoolConfig.h"
+#include "RingBuffer.h"
+#include "Job.h"
+
+#include <memory>
+#include <mutex>
+
+/**
+ * @brief Shared job queue of one priority lane
+ *
+ * Lets the pool swap the queue implementation (see QueueBackend) without touching
+ * the scheduling code. Every method is thread-safe.
+ */
+class JobQueue
+{
+public:
+
+    //////// CONSTRUCTOR ////////
+    virtual ~JobQueue() = default;
+
+	//////// STATIC METHODS ////////
+    static std::unique_ptr<JobQueue> Create(QueueBackend backend, size_t capacity);
+
+	//////// METHODS ////////
+    virtual bool TryPush(Job& job) = 0;
+    virtual size_t TryPushBatch(Job* jobs, size_t count) = 0;
+    virtual bool TryPop(Job& outJob) = 0;
+    virtual size_t Clear() = 0;
+    [[nodiscard]] virtual size_t Size() const = 0;
+    [[nodiscard]] virtual bool IsBounded() const = 0;
+};
+
+/**
+ * @brief Unbounded FIFO guarded by a mutex
+ *
+ * Never rejects a job; a batch is pushed under a single lock acquisition.
+ */
+class LockedJobQueue : public JobQueue
+{
+public:
+
+	//////// METHODS ////////
+    bool TryPush(Job& job) override;
+    size_t TryPushBatch(Job* jobs, size_t count) override;
+    bool TryPop(Job& outJob) override;
+    size_t Clear() override;
+    [[nodiscard]] size_t Size() const override;
+    [[nodiscard]] bool IsBounded() const override { return false; }
+
+private:
+
+    //////// FIELDS ////////
+    mutable std::mutex queueMutex;
+    RingBuffer<Job> jobs;
+};
+
+/**
+ * @brief Bounded FIFO on top of the lock-free BoundedMPMCQueue
+ *
+ * Push fails when the ring is full; the pool then applies its OverflowPolicy.
+ */
+class LockFreeJobQueue : public JobQueue
+{
+public:
+
+    //////// CONSTRUCTOR ////////
+    explicit LockFreeJobQueue(size_t capacity);
+
+	//////// METHODS ////////
+    bool TryPush(Job& job) override;
+    size_t TryPushBatch(Job* jobs, size_t count) override;
+    bool TryPop(Job& outJob) override;
+    size_t Clear() override;
+    [[nodiscard]] size_t Size() const override;
+    [[nodiscard]] bool IsBounded() const override { return true; }
+
+private:
+
+    //////// FIELDS ////////
+    BoundedMPMCQueue<Job> ring;
+};
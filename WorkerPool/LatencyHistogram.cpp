@@ -0,0 +1,138 @@
+#include "LatencyHistogram.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+/**
+ * @brief Records one duration.
+ *
+ * Only the owning thread writes, so plain load/store pairs are enough and no
+ * read-modify-write is needed on the shared counters.
+ */
+void LatencyHistogram::Record(uint64_t nanoseconds)
+{
+    std::atomic<uint64_t>& bucket = buckets[GetBucketIndex(nanoseconds)];
+    bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    if (nanoseconds > max.load(std::memory_order_relaxed))
+    {
+        max.store(nanoseconds, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Adds the counts of another histogram to this one.
+ *
+ * The target must not be written concurrently (typically a local histogram built for a report).
+ */
+void LatencyHistogram::Merge(const LatencyHistogram& other)
+{
+    for (size_t i = 0; i < BucketCount; i++)
+    {
+        buckets[i].store(buckets[i].load(std::memory_order_relaxed) + other.buckets[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+    count.store(count.load(std::memory_order_relaxed) + other.count.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    max.store(std::max(max.load(std::memory_order_relaxed), other.max.load(std::memory_order_relaxed)), std::memory_order_relaxed);
+}
+
+/**
+ * @brief Get the number of recorded durations.
+ */
+uint64_t LatencyHistogram::GetCount() const
+{
+    return count.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Get the largest recorded duration (exact, not bucketed).
+ */
+uint64_t LatencyHistogram::GetMax() const
+{
+    return max.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Get the duration below which the given percentage of the recorded values fall.
+ *
+ * @param percentile Percentage in [0, 100]
+ * @return Upper bound of the bucket holding that rank, capped to the exact maximum
+ */
+uint64_t LatencyHistogram::GetPercentile(double percentile) const
+{
+    uint64_t total = 0;
+    for (size_t i = 0; i < BucketCount; i++)
+    {
+        total += buckets[i].load(std::memory_order_relaxed);
+    }
+
+    if (total == 0)
+    {
+        return 0;
+    }
+
+    const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(percentile / 100.0 * total)));
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BucketCount; i++)
+    {
+        seen += buckets[i].load(std::memory_order_relaxed);
+        if (seen >= rank)
+        {
+            return std::min(GetBucketUpperBound(i), GetMax());
+        }
+    }
+
+    return GetMax();
+}
+
+/**
+ * @brief Extracts the usual percentiles in one call.
+ */
+LatencySummary LatencyHistogram::Summarize() const
+{
+    LatencySummary summary;
+    summary.count = GetCount();
+    summary.p50 = GetPercentile(50.0);
+    summary.p90 = GetPercentile(90.0);
+    summary.p99 = GetPercentile(99.0);
+    summary.max = GetMax();
+    return summary;
+}
+
+/**
+ * @brief Maps a value to its bucket.
+ *
+ * Values below SubBucketCount get one bucket each. Above that, the position of the leading bit
+ * selects the power-of-two group and the next SubBucketBits bits select the sub-bucket.
+ */
+size_t LatencyHistogram::GetBucketIndex(uint64_t value)
+{
+    if (value < SubBucketCount)
+    {
+        return static_cast<size_t>(value);
+    }
+
+    const uint32_t exponent = 63 - std::countl_zero(value);
+    const uint32_t shift = exponent - SubBucketBits;
+    const uint64_t subBucket = (value >> shift) - SubBucketCount;
+    return SubBucketCount + shift * SubBucketCount + static_cast<size_t>(subBucket);
+}
+
+/**
+ * @brief Get the largest value that maps to a bucket.
+ */
+uint64_t LatencyHistogram::GetBucketUpperBound(size_t index)
+{
+    if (index < SubBucketCount)
+    {
+        return index;
+    }
+
+    const uint64_t shift = (index - SubBucketCount) / SubBucketCount;
+    const uint64_t subBucket = (index - SubBucketCount) % SubBucketCount;
+    const uint64_t lowerBound = (SubBucketCount + subBucket) << shift;
+    return lowerBound + ((uint64_t{ 1 } << shift) - 1);
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Percentiles extracted from a LatencyHistogram, in nanoseconds
+ */
+struct LatencySummary
+{
+    uint64_t count = 0;
+    uint64_t p50 = 0;
+    uint64_t p90 = 0;
+    uint64_t p99 = 0;
+    uint64_t max = 0;
+};
+
+/**
+ * @brief Log-linear (HDR-style) histogram of durations in nanoseconds
+ *
+ * Each power of two is split into 16 linear sub-buckets, so any recorded value is
+ * reported within ~6% of its real value, from 1 ns up to the full 64-bit range, in
+ * a fixed array of counters. Recording is meant for a single writer thread (one
+ * histogram per worker) and costs a couple of relaxed atomic operations; any thread
+ * may read it or merge it into another histogram at any time.
+ */
+class LatencyHistogram
+{
+public:
+
+    //////// CONSTRUCTOR ////////
+    LatencyHistogram() = default;
+
+	//////// DELETED METHODS ////////
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+	//////// METHODS ////////
+    //// Writer
+    void Record(uint64_t nanoseconds);
+
+    //// Readers
+    void Merge(const LatencyHistogram& other);
+    [[nodiscard]] uint64_t GetCount() const;
+    [[nodiscard]] uint64_t GetMax() const;
+    [[nodiscard]] uint64_t GetPercentile(double percentile) const;
+    [[nodiscard]] LatencySummary Summarize() const;
+
+private:
+
+	//////// STATIC METHODS ////////
+    static size_t GetBucketIndex(uint64_t value);
+    static uint64_t GetBucketUpperBound(size_t index);
+
+    //////// CONSTANTS ////////
+    static constexpr uint32_t SubBucketBits = 4;
+    static constexpr uint32_t SubBucketCount = 1u << SubBucketBits;
+    static constexpr size_t BucketCount = SubBucketCount + (64 - SubBucketBits) * SubBucketCount;
+
+    //////// FIELDS ////////
+    std::atomic<uint64_t> buckets[BucketCount] = {};
+    std::atomic<uint64_t> count{ 0 };
+    std::atomic<uint64_t> max{ 0 };
+};
@@ -0,0 +1,258 @@
+#include "LogSink.h"
+
+#include <condition_variable>
+#include <algorithm>
+#include <iostream>
+#include <cstdlib>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+namespace
+{
+    static_assert((LogSink::RingCapacity & (LogSink::RingCapacity - 1)) == 0, "RingCapacity must be a power of two");
+
+    /**
+     * @brief Single-producer/single-consumer ring of one thread's records
+     *
+     * The producer keeps a stale copy of the consumer position, so it only reads the
+     * consumer's cache line when the ring looks full.
+     */
+    struct LogRing
+    {
+        alignas(64) std::atomic<size_t> writePosition{ 0 };
+        size_t cachedReadPosition = 0;
+        alignas(64) std::atomic<size_t> readPosition{ 0 };
+        std::atomic<bool> abandoned{ false };
+        LogRecord records[LogSink::RingCapacity];
+    };
+
+    /**
+     * @brief Rings of every thread and the thread draining them
+     *
+     * Never destroyed: threads that outlive static destruction may still write. The drain
+     * thread is stopped and the rings drained one last time at exit.
+     */
+    struct SinkState
+    {
+        std::mutex registryMutex;
+        std::vector<std::shared_ptr<LogRing>> rings;
+        std::jthread drainThread;
+
+        std::mutex wakeMutex;
+        std::condition_variable_any wakeCondition;
+        std::atomic<bool> drainRequested{ false };
+
+        //// Only touched while holding drainMutex
+        std::mutex drainMutex;
+        std::vector<std::shared_ptr<LogRing>> drainedRings;
+        std::vector<LogRecord> pending;
+        std::string text;
+
+        std::atomic<uint64_t> droppedCount{ 0 };
+        uint64_t reportedDroppedCount = 0;
+    };
+
+    SinkState& GetState()
+    {
+        static SinkState* state = new SinkState();
+        return *state;
+    }
+
+    /**
+     * @brief Appends the text of one record to the output buffer
+     */
+    void FormatRecord(const LogRecord& record, std::string& text)
+    {
+        char line[256];
+        int length = record.jobId
+            ? std::snprintf(line, sizeof(line), "[%s > %3llu] %s", record.source, static_cast<unsigned long long>(*record.jobId), record.message)
+            : std::snprintf(line, sizeof(line), "[%s] %s", record.source, record.message);
+
+        for (size_t i = 0; i < 2 && record.labels[i] != nullptr; i++)
+        {
+            length += std::snprintf(line + length, sizeof(line) - length, " | %s: %lld", record.labels[i], static_cast<long long>(record.values[i]));
+        }
+
+        if (record.workerID >= 0)
+        {
+            length += std::snprintf(line + length, sizeof(line) - length, " (Worker%d)", record.workerID);
+        }
+
+        text.append(line, std::min<size_t>(length, sizeof(line) - 1));
+        text.push_back('\n');
+    }
+
+    /**
+     * @brief Moves every record written so far to the console, in timestamp order (caller holds drainMutex)
+     */
+    void DrainRings(SinkState& state)
+    {
+        {
+            std::scoped_lock lock(state.registryMutex);
+            state.drainedRings = state.rings;
+        }
+
+        for (const auto& ring : state.drainedRings)
+        {
+            const bool abandoned = ring->abandoned.load(std::memory_order_acquire);
+            size_t readPosition = ring->readPosition.load(std::memory_order_relaxed);
+            const size_t writePosition = ring->writePosition.load(std::memory_order_acquire);
+
+            while (readPosition != writePosition)
+            {
+                state.pending.push_back(ring->records[readPosition & (LogSink::RingCapacity - 1)]);
+                readPosition++;
+            }
+            ring->readPosition.store(readPosition, std::memory_order_release);
+
+            if (abandoned)
+            {
+                std::scoped_lock lock(state.registryMutex);
+                std::erase(state.rings, ring);
+            }
+        }
+        state.drainedRings.clear();
+
+        const uint64_t dropped = state.droppedCount.load(std::memory_order_relaxed);
+        if (state.pending.empty() && dropped == state.reportedDroppedCount)
+        {
+            return;
+        }
+
+        std::stable_sort(state.pending.begin(), state.pending.end(), [](const LogRecord& a, const LogRecord& b)
+        {
+            return a.timestamp < b.timestamp;
+        });
+
+        for (const LogRecord& record : state.pending)
+        {
+            FormatRecord(record, state.text);
+        }
+        if (dropped != state.reportedDroppedCount)
+        {
+            state.text += "[Log] " + std::to_string(dropped - state.reportedDroppedCount) + " records dropped (ring full)\n";
+            state.reportedDroppedCount = dropped;
+        }
+
+        std::cout.write(state.text.data(), static_cast<std::streamsize>(state.text.size()));
+        std::cout.flush();
+        state.pending.clear();
+        state.text.clear();
+    }
+
+    void DrainLoop(std::stop_token stopToken)
+    {
+        SinkState& state = GetState();
+        while (!stopToken.stop_requested())
+        {
+            {
+                std::unique_lock lock(state.wakeMutex);
+                state.wakeCondition.wait_for(lock, stopToken, LogSink::DrainInterval, [&state]
+                {
+                    return state.drainRequested.exchange(false);
+                });
+            }
+
+            std::scoped_lock lock(state.drainMutex);
+            DrainRings(state);
+        }
+    }
+
+    void StopDrainThread()
+    {
+        SinkState& state = GetState();
+        state.drainThread.request_stop();
+        if (state.drainThread.joinable())
+        {
+            state.drainThread.join();
+        }
+
+        std::scoped_lock lock(state.drainMutex);
+        DrainRings(state);
+    }
+
+    /**
+     * @brief Registers the ring of the current thread on first use and flags it when the thread exits
+     */
+    struct ThreadRing
+    {
+        std::shared_ptr<LogRing> ring;
+
+        ThreadRing() : ring(std::make_shared<LogRing>())
+        {
+            SinkState& state = GetState();
+            std::scoped_lock lock(state.registryMutex);
+            state.rings.push_back(ring);
+
+            if (!state.drainThread.joinable())
+            {
+                state.drainThread = std::jthread(DrainLoop);
+                std::atexit(StopDrainThread);
+            }
+        }
+
+        ~ThreadRing()
+        {
+            ring->abandoned.store(true, std::memory_order_release);
+        }
+    };
+}
+
+/**
+ * @brief Queues a record in the calling thread's ring, or drops it if the ring is full.
+ *
+ * The record is stamped here; the caller is expected to have checked its level beforehand.
+ */
+void LogSink::Write(const LogRecord& record)
+{
+    thread_local ThreadRing threadRing;
+    LogRing& ring = *threadRing.ring;
+
+    const size_t writePosition = ring.writePosition.load(std::memory_order_relaxed);
+    if (writePosition - ring.cachedReadPosition >= RingCapacity)
+    {
+        ring.cachedReadPosition = ring.readPosition.load(std::memory_order_acquire);
+        if (writePosition - ring.cachedReadPosition >= RingCapacity)
+        {
+            GetState().droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    LogRecord& slot = ring.records[writePosition & (RingCapacity - 1)];
+    slot = record;
+    slot.timestamp = std::chrono::steady_clock::now().time_since_epoch().count();
+    ring.writePosition.store(writePosition + 1, std::memory_order_release);
+
+    if (writePosition - ring.cachedReadPosition == RingCapacity / 2)
+    {
+        SinkState& state = GetState();
+        state.drainRequested = true;
+        state.wakeCondition.notify_one();
+    }
+}
+
+/**
+ * @brief Writes every record queued so far to the console before returning.
+ *
+ * Call it before printing directly to std::cout, so earlier records are not printed after that output.
+ */
+void LogSink::Flush()
+{
+    SinkState& state = GetState();
+    std::scoped_lock lock(state.drainMutex);
+    DrainRings(state);
+}
+
+/**
+ * @brief Get the number of records dropped because their thread's ring was full.
+ */
+uint64_t LogSink::GetDroppedCount()
+{
+    return GetState().droppedCount.load(std::memory_order_relaxed);
+}
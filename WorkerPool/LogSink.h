@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <chrono>
+
+/**
+ * @brief Severity of a log record, checked by the caller before building the record
+ */
+enum class LogLevel : uint8_t
+{
+    Trace,
+    Debug,
+    Info,
+    Warning,
+    Error,
+    Off
+};
+
+/**
+ * @brief Unformatted log record
+ *
+ * Only holds plain values and pointers to string literals, so writing one is a copy
+ * into a ring slot: the text is built by the drain thread, off the caller's path.
+ * Output: "[source > jobId] message | label0: value0 | label1: value1 (WorkerN)",
+ * where the job ID, labels and worker are omitted when unset.
+ */
+struct LogRecord
+{
+    LogLevel level = LogLevel::Info;
+    const char* message = "";
+    std::optional<uint64_t> jobId = {};
+    int32_t workerID = -1;
+    const char* labels[2] = {};
+    int64_t values[2] = {};
+    const char* source = "";
+    int64_t timestamp = 0;
+};
+
+/**
+ * @brief Asynchronous console sink shared by every thread of the process
+ *
+ * Each thread writes into its own fixed-size single-producer ring, registered on its
+ * first record, so a write is a few plain stores and one release store, without any
+ * lock or formatting. A background thread wakes every DrainInterval (or earlier when a
+ * ring is half full), collects every ring, orders the records by timestamp, formats
+ * them and hands the whole batch to std::cout in one write. A record written while its
+ * ring is full is dropped and counted instead of blocking the writer.
+ */
+class LogSink
+{
+public:
+
+    //////// CONSTANTS ////////
+    static constexpr size_t RingCapacity = 1024;
+    static constexpr std::chrono::milliseconds DrainInterval{ 10 };
+
+	//////// STATIC METHODS ////////
+    static void Write(const LogRecord& record);
+    static void Flush();
+
+    //// Stats
+    [[nodiscard]] static uint64_t GetDroppedCount();
+};
@@ -1,3 +1,4 @@
+#include "ParallelAlgorithms.h"
 #include "WorkerPool.h"
 
 #include <functional>
@@ -9,13 +10,13 @@
 #include <queue>
 
 /**
- * @brief Adds a quick job to the WorkerPool.
+ * @brief Creates a quick job.
  * 
- * This function adds a job to the WorkerPool that prints a hello message.
+ * The job prints a hello message.
  */
-void LunchQuickTack(WorkerPool& pool, bool silent = false)
+Job MakeQuickTask(bool silent = false)
 {
-    pool.AddJob([silent]()
+    return Job([silent]()
         {
             if (!silent)
             {
@@ -25,14 +26,13 @@ void LunchQuickTack(WorkerPool& pool, bool silent = false)
 }
 
 /**
- * @brief Adds a long job to the WorkerPool.
+ * @brief Creates a long job.
  * 
- * This function adds a job to the WorkerPool that simulates a long task by
- * sleeping for 3 seconds and then prints a completion message.
+ * The job simulates a long task by sleeping for 3 seconds and then prints a completion message.
  */
-void LunchLongTask(WorkerPool& pool, bool silent = false)
+Job MakeLongTask(bool silent = false)
 {
-    pool.AddJob([silent]()
+    return Job([silent]()
         {
             if (!silent)
             {
@@ -49,15 +49,17 @@ void LunchLongTask(WorkerPool& pool, bool silent = false)
 }
 
 /**
- * @brief Adds a math job to the WorkerPool.
+ * @brief Creates a math job.
  * 
- * This function adds a job to the WorkerPool that generates two random integers,
- * adds them together, and prints the result.
+ * The job generates two random integers, adds them together, and prints the result. The numbers come
+ * from the random engine of the worker running the job, so concurrent math jobs never share an engine.
  */
-void LunchMathTask(WorkerPool& pool, std::uniform_int_distribution<>& dis, std::mt19937& gen, bool silent = false)
+Job MakeMathTask(bool silent = false)
 {
-    pool.AddJob([&dis, &gen, silent]()
+    return Job([silent]()
         {
+            std::uniform_int_distribution<> dis(1, 100);
+            WorkerContext::RandomEngine& gen = WorkerPool::GetContext().GetRandom();
             int num1 = dis(gen);
             int num2 = dis(gen);
 
@@ -68,22 +70,94 @@ void LunchMathTask(WorkerPool& pool, std::uniform_int_distribution<>& dis, std::
         });
 }
 
+/**
+ * @brief Creates a random job.
+ * 
+ * This function randomly selects a type of task (quick, long, or math) and creates it.
+ */
+Job MakeRandomTask(std::mt19937& gen, bool silent = false)
+{
+    std::uniform_int_distribution<> taskDis(1, 3);
+    int taskType = taskDis(gen);
+
+    switch (taskType)
+    {
+    case 1:
+        return MakeQuickTask(silent);
+    case 2:
+        return MakeLongTask(silent);
+    default:
+        return MakeMathTask(silent);
+    }
+}
+
+/**
+ * @brief Adds a quick job to the WorkerPool.
+ * 
+ * This function adds a job to the WorkerPool that prints a hello message.
+ */
+void LunchQuickTack(WorkerPool& pool, bool silent = false)
+{
+    pool.AddJob(MakeQuickTask(silent));
+}
+
+/**
+ * @brief Coroutine version of the long task.
+ * 
+ * Waits 3 seconds with co_await pool.Delay instead of sleeping, so no worker is held meanwhile.
+ */
+CoTask<> LongTaskCoroutine(WorkerPool& pool)
+{
+    std::cout << "[WorkerPool > Task] Starting long task (3s)...\n";
+    co_await pool.Delay(std::chrono::seconds(3));
+    std::cout << "[WorkerPool > Task] Long task finished!\n";
+}
+
+/**
+ * @brief Adds a long job to the WorkerPool.
+ * 
+ * This function spawns a coroutine on the WorkerPool that waits for 3 seconds
+ * without blocking a worker and then prints a completion message.
+ */
+void LunchLongTask(WorkerPool& pool)
+{
+    pool.Spawn(LongTaskCoroutine(pool));
+}
+
+/**
+ * @brief Adds a math job to the WorkerPool.
+ * 
+ * This function adds a job to the WorkerPool that generates two random integers,
+ * adds them together, and prints the result.
+ */
+void LunchMathTask(WorkerPool& pool, bool silent = false)
+{
+    pool.AddJob(MakeMathTask(silent));
+}
+
+/**
+ * @brief Coroutine printing a message five times, 500 milliseconds apart.
+ * 
+ * The worker is given back to the pool during each delay.
+ */
+CoTask<> MultiplePrintsCoroutine(WorkerPool& pool)
+{
+    for (int i = 0; i < 5; i++)
+    {
+        std::cout << "[WorkerPool > Task] Print " << i + 1 << "/5\n";
+        co_await pool.Delay(std::chrono::milliseconds(500));
+    }
+}
+
 /**
  * @brief Adds a multiple print job to the WorkerPool.
  * 
- * This function adds a job to the WorkerPool that prints a message five times,
+ * This function spawns a coroutine on the WorkerPool that prints a message five times,
  * with a 500 milliseconds delay between each print.
  */
 void LunchMultipleQuickTask(WorkerPool& pool)
 {
-    pool.AddJob([]()
-    {
-        for (int i = 0; i < 5; i++)
-        {
-            std::cout << "[WorkerPool > Task] Print " << i + 1 << "/5\n";
-            std::this_thread::sleep_for(std::chrono::milliseconds(500));
-        }
-    });
+    pool.Spawn(MultiplePrintsCoroutine(pool));
 }
 
 /**
@@ -91,54 +165,376 @@ void LunchMultipleQuickTask(WorkerPool& pool)
  * 
  * This function randomly selects a type of task (quick, long, or math) and adds it to the WorkerPool.
  */
-void LaunchRandomTask(WorkerPool& pool, std::uniform_int_distribution<>& dis, std::mt19937& gen, bool silent = false)
+void LaunchRandomTask(WorkerPool& pool, std::mt19937& gen, bool silent = false)
 {
-    std::uniform_int_distribution<> taskDis(1, 3);
-    int taskType = taskDis(gen);
-
-    switch (taskType)
-    {
-    case 1:
-        LunchQuickTack(pool, silent);
-        break;
-    case 2:
-        LunchLongTask(pool, silent);
-        break;
-    case 3:
-        LunchMathTask(pool, dis, gen, silent);
-        break;
-    }
+    pool.AddJob(MakeRandomTask(gen, silent));
 }
 
 /**
  * @brief Launches multiple random tasks in the WorkerPool.
  * 
- * This function adds a specified number of random tasks to the WorkerPool and
- * waits for all tasks to complete. It measures and prints the total execution
- * time and the average time per task.
+ * This function builds a specified number of random tasks, submits them to the WorkerPool
+ * in a single batch and waits for all tasks to complete. It measures and prints the total
+ * execution time and the average time per task.
  */
-void LaunchMultipleRandomTasks(WorkerPool& pool, std::uniform_int_distribution<>& dis, std::mt19937& gen, int numTasks)
+void LaunchMultipleRandomTasks(WorkerPool& pool, std::mt19937& gen, int numTasks)
 {
     std::cout << "\n[WorkerPool] Launching batch of " << numTasks << " random tasks...\n";
 
     auto startTime = std::chrono::high_resolution_clock::now();
 
+    std::vector<Job> tasks;
+    tasks.reserve(numTasks);
     for (int i = 0; i < numTasks; i++)
     {
-        LaunchRandomTask(pool, dis, gen, true);
+        tasks.push_back(MakeRandomTask(gen, true));
     }
 
+    pool.AddJobs(std::move(tasks));
     pool.WaitForCompletion();
 
     auto endTime = std::chrono::high_resolution_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime);
 
+    LogSink::Flush();
     std::cout << "[WorkerPool] Batch completed:\n";
     std::cout << "- Tasks launched: " << numTasks << "\n";
     std::cout << "- Total execution time: " << duration.count() << "ms\n";
     std::cout << "- Average time per task: " << duration.count() / numTasks << "ms\n\n";
 }
 
+/**
+ * @brief Launches a mix of long and quick tasks on different priority lanes.
+ * 
+ * Long tasks go to the Low lane and quick ones to the High lane, so quick tasks should not wait behind the
+ * long ones. Once everything is done, the queue-wait latency percentiles of each lane are printed.
+ */
+void LaunchPriorityMix(WorkerPool& pool, int numLongTasks, int numQuickTasks)
+{
+    std::cout << "\n[WorkerPool] Launching " << numLongTasks << " low-priority long tasks and "
+              << numQuickTasks << " high-priority quick tasks...\n";
+
+    pool.AddJobs(numLongTasks, [](size_t) { return MakeLongTask(true); }, JobPriority::Low);
+    for (int i = 0; i < numQuickTasks; i++)
+    {
+        pool.AddJob(MakeQuickTask(true), JobPriority::High);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+
+    pool.WaitForCompletion();
+    pool.PrintLaneLatencyReport();
+}
+
+/**
+ * @brief Prints a telemetry snapshot of the WorkerPool as JSON.
+ * 
+ * Shows per-lane queue-wait and execution percentiles, queue-depth high-water marks and
+ * the busy/idle/steal counters of every worker.
+ */
+void PrintTelemetry(const WorkerPool& pool)
+{
+    LogSink::Flush();
+    std::cout << "\n[WorkerPool] Telemetry snapshot:\n" << pool.GetStats().ToJson() << "\n";
+}
+
+/**
+ * @brief Measures the wake-up latency of each idle policy.
+ * 
+ * For every policy, a dedicated pool receives micro-jobs one at a time, with a busy-waited gap between
+ * submissions so the workers are idle when each job arrives. The queue wait of those jobs is the time the
+ * pool needs to notice and start them. Gaps shorter than the spin window are where spinning pays off;
+ * with longer gaps every policy ends up parking.
+ */
+void RunWakeLatencyBenchmark(int numJobs, std::chrono::microseconds gap)
+{
+    const IdlePolicy policies[] = { IdlePolicy::Park, IdlePolicy::SpinThenPark, IdlePolicy::YieldThenPark };
+    const char* const policyNames[] = { "Park", "SpinThenPark", "YieldThenPark" };
+
+    LogSink::Flush();
+    std::cout << "\n[WorkerPool] Wake latency benchmark: " << numJobs << " jobs, " << gap.count() << "us apart (queue wait in us)\n";
+
+    for (size_t i = 0; i < std::size(policies); i++)
+    {
+        WorkerPoolConfig config;
+        config.idlePolicy = policies[i];
+        config.idleSpinDuration = std::chrono::microseconds(200);
+        config.logLevel = LogLevel::Off;
+        WorkerPool benchmarkPool(config);
+
+        for (int job = 0; job < numJobs; job++)
+        {
+            benchmarkPool.AddJob([]() {});
+
+            const auto nextSubmission = std::chrono::steady_clock::now() + gap;
+            while (std::chrono::steady_clock::now() < nextSubmission)
+            {
+            }
+        }
+        benchmarkPool.WaitForCompletion();
+
+        const LatencySummary wait = benchmarkPool.GetLaneLatency(JobPriority::Normal);
+        std::cout << "- " << policyNames[i] << " | p50: " << wait.p50 / 1000.0 << " | p90: " << wait.p90 / 1000.0
+                  << " | p99: " << wait.p99 / 1000.0 << " | max: " << wait.max / 1000.0 << "\n";
+    }
+    std::cout << "\n";
+}
+
+/**
+ * @brief Coroutine waiting one second then counting itself as finished.
+ */
+CoTask<> WaitingCoroutine(WorkerPool& pool, std::atomic<int>& finished)
+{
+    co_await pool.Delay(std::chrono::seconds(1));
+    finished++;
+}
+
+/**
+ * @brief Launches thousands of coroutines that all wait at the same time.
+ * 
+ * Each coroutine waits one second; since a waiting coroutine holds no worker, they all complete
+ * after about one second on the pool's few threads, where sleeping jobs would take minutes.
+ */
+void LaunchConcurrentWaits(WorkerPool& pool, int numCoroutines)
+{
+    LogSink::Flush();
+    std::cout << "\n[WorkerPool] Launching " << numCoroutines << " coroutines waiting 1s each...\n";
+
+    std::atomic<int> finished{ 0 };
+    auto startTime = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < numCoroutines; i++)
+    {
+        pool.Spawn(WaitingCoroutine(pool, finished));
+    }
+    pool.WaitForCompletion();
+
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime);
+    LogSink::Flush();
+    std::cout << "[WorkerPool] " << finished << " coroutines finished in " << duration.count() << "ms\n\n";
+}
+
+/**
+ * @brief Shows delayed and periodic jobs.
+ * 
+ * A periodic job prints every 200 milliseconds, a delayed job cancels it after one second,
+ * and a second delayed job is cancelled before it ever runs. No worker sleeps in the meantime.
+ */
+void LaunchTimersDemo(WorkerPool& pool)
+{
+    std::cout << "\n[WorkerPool] Periodic job every 200ms, cancelled after 1s...\n";
+
+    auto tickCount = std::make_shared<std::atomic<int>>(0);
+    const TimerId periodicTimer = pool.AddPeriodicJob(std::chrono::milliseconds(200), [tickCount]()
+    {
+        std::cout << "[WorkerPool > Task] Tick " << ++*tickCount << "\n";
+    });
+
+    pool.AddDelayedJob(std::chrono::seconds(1), [&pool, periodicTimer]()
+    {
+        pool.CancelTimer(periodicTimer);
+        std::cout << "[WorkerPool > Task] Periodic job cancelled\n";
+    });
+
+    const TimerId neverRun = pool.AddDelayedJob(std::chrono::milliseconds(500), []()
+    {
+        std::cout << "[WorkerPool > Task] This should not be printed\n";
+    });
+    pool.CancelTimer(neverRun);
+}
+
+/**
+ * @brief Shows job groups and cooperative cancellation.
+ * 
+ * Two requests fan out at once. The search is cancelled after 300 milliseconds: its queued jobs are skipped
+ * and its running ones return at their next token check, while every job of the save request still runs.
+ */
+void LaunchGroupCancellation(WorkerPool& pool, int numJobs)
+{
+    std::cout << "\n[WorkerPool] Search (" << numJobs << " jobs of 100ms) and save (" << numJobs << " quick jobs), search cancelled after 300ms...\n";
+
+    auto searched = std::make_shared<std::atomic<int>>(0);
+    auto saved = std::make_shared<std::atomic<int>>(0);
+    JobGroup search = pool.CreateGroup();
+    JobGroup save = pool.CreateGroup();
+
+    pool.AddJobsToGroup(search, numJobs, [searched](size_t)
+    {
+        return [searched]()
+        {
+            for (int step = 0; step < 10; step++)
+            {
+                if (WorkerPool::GetStopToken().stop_requested())
+                {
+                    return;
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+            ++*searched;
+        };
+    });
+    pool.AddJobsToGroup(save, numJobs, [saved](size_t)
+    {
+        return [saved]() { ++*saved; };
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    const size_t cancelled = pool.CancelGroup(search);
+    pool.WaitForGroup(search);
+    pool.WaitForGroup(save);
+
+    LogSink::Flush();
+    std::cout << "[WorkerPool] Search: " << *searched << "/" << numJobs << " completed, " << cancelled << " cancelled while pending\n";
+    std::cout << "[WorkerPool] Save: " << *saved << "/" << numJobs << " completed\n\n";
+}
+
+/**
+ * @brief Compares a fixed pool with an elastic one when workers block.
+ * 
+ * Each pool starts with two workers, both of which get stuck in a one-second sleep, then receives quick jobs.
+ * The fixed pool runs them only once a sleeper returns; the elastic pool spawns workers for them and retires
+ * those workers once they have been idle for a while. The elastic pool's scaling events are printed.
+ */
+void RunElasticDemo(int numQuickJobs)
+{
+    LogSink::Flush();
+    std::cout << "\n[WorkerPool] 2 blocked workers, then " << numQuickJobs << " quick jobs (5ms each)\n";
+
+    for (const uint32_t maxWorkers : { 2u, 8u })
+    {
+        WorkerPoolConfig config;
+        config.workerCount = 2;
+        config.maxWorkerCount = maxWorkers;
+        config.retireDelay = std::chrono::milliseconds(500);
+        config.logLevel = LogLevel::Off;
+        WorkerPool elasticPool(config);
+
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < 2; i++)
+        {
+            elasticPool.AddJob([]() { std::this_thread::sleep_for(std::chrono::seconds(1)); });
+        }
+
+        std::atomic<int> quickJobsDone{ 0 };
+        std::chrono::steady_clock::duration quickJobsTime{};
+        elasticPool.AddJobs(numQuickJobs, [&](size_t)
+        {
+            return [&, numQuickJobs]()
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                if (++quickJobsDone == numQuickJobs)
+                {
+                    quickJobsTime = std::chrono::steady_clock::now() - start;
+                }
+            };
+        });
+        elasticPool.WaitForCompletion();
+        std::this_thread::sleep_for(std::chrono::milliseconds(700));
+
+        const WorkerPoolStats stats = elasticPool.GetStats();
+        std::cout << "- Max workers " << maxWorkers << " | quick jobs done after "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(quickJobsTime).count() << "ms | peak workers: "
+                  << stats.scaling.peakWorkers << " | workers now: " << stats.scaling.activeWorkers << "\n";
+        for (const ScalingEvent& event : stats.scaling.recentEvents)
+        {
+            std::cout << "    " << event.timeNanoseconds / 1'000'000 << "ms: worker " << event.workerID
+                      << (event.action == ScalingAction::Spawned ? " spawned" : " retired") << " -> " << event.workerCount
+                      << " workers (queued: " << event.queuedJobs << ", blocked: " << event.blockedWorkers << ")\n";
+        }
+    }
+    std::cout << "\n";
+}
+
+/**
+ * @brief Estimates pi with jobs using their worker's context.
+ * 
+ * Each job draws its points from its worker's random engine into scratch memory, then counts those inside
+ * the unit circle. No engine or buffer is shared, and the scratch memory is recycled after every job.
+ */
+void LaunchMonteCarloPi(WorkerPool& pool, int numJobs, int pointsPerJob)
+{
+    std::cout << "\n[WorkerPool] Estimating pi with " << numJobs << " jobs of " << pointsPerJob << " random points...\n";
+
+    std::vector<int> insideCounts(numJobs);
+    pool.AddJobs(numJobs, [&insideCounts, pointsPerJob](size_t job)
+    {
+        return [&insideCounts, pointsPerJob, job]()
+        {
+            WorkerContext& context = WorkerPool::GetContext();
+            std::uniform_real_distribution<float> coordinate(-1.0f, 1.0f);
+
+            float* points = context.GetScratch().AllocateArray<float>(2 * static_cast<size_t>(pointsPerJob));
+            for (int i = 0; i < 2 * pointsPerJob; i++)
+            {
+                points[i] = coordinate(context.GetRandom());
+            }
+
+            int inside = 0;
+            for (int i = 0; i < pointsPerJob; i++)
+            {
+                inside += points[2 * i] * points[2 * i] + points[2 * i + 1] * points[2 * i + 1] <= 1.0f ? 1 : 0;
+            }
+            insideCounts[job] = inside;
+        };
+    });
+    pool.WaitForCompletion();
+
+    long long inside = 0;
+    for (const int count : insideCounts)
+    {
+        inside += count;
+    }
+
+    LogSink::Flush();
+    std::cout << "[WorkerPool] Pi ~= " << 4.0 * static_cast<double>(inside) / (static_cast<double>(numJobs) * pointsPerJob) << "\n\n";
+}
+
+/**
+ * @brief Runs a parallel for, reduce and inclusive scan over the same array on the pool's threads.
+ * 
+ * The scan's last element must match the reduction, which the output checks.
+ */
+void LaunchParallelAlgorithms(WorkerPool& pool, size_t elementCount)
+{
+    std::cout << "\n[WorkerPool] Parallel algorithms over " << elementCount << " elements...\n";
+
+    std::vector<long long> values(elementCount);
+    std::vector<long long> prefixSums(elementCount);
+    const auto start = std::chrono::steady_clock::now();
+
+    ParallelFor(pool, 0, elementCount, [&values](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            values[i] = static_cast<long long>(i % 100);
+        }
+    });
+    const auto filled = std::chrono::steady_clock::now();
+
+    const long long sum = ParallelReduce(pool, 0, elementCount, 0LL, [&values](size_t begin, size_t end)
+    {
+        long long partial = 0;
+        for (size_t i = begin; i < end; i++)
+        {
+            partial += values[i];
+        }
+        return partial;
+    }, std::plus<>());
+    const auto reduced = std::chrono::steady_clock::now();
+
+    ParallelInclusiveScan(pool, values.begin(), values.end(), prefixSums.begin());
+    const auto scanned = std::chrono::steady_clock::now();
+
+    auto elapsedMs = [](auto from, auto to)
+    {
+        return std::chrono::duration<double, std::milli>(to - from).count();
+    };
+
+    LogSink::Flush();
+    std::cout << "[WorkerPool] For: " << elapsedMs(start, filled) << "ms, reduce: " << elapsedMs(filled, reduced)
+              << "ms (sum " << sum << "), scan: " << elapsedMs(reduced, scanned) << "ms ("
+              << (elementCount == 0 || prefixSums.back() == sum ? "matches" : "DOES NOT match") << " the sum)\n\n";
+}
+
 /**
  * @brief Main function to run the WorkerPool example.
  * 
@@ -149,14 +545,28 @@ void LaunchMultipleRandomTasks(WorkerPool& pool, std::uniform_int_distribution<>
  * 
  * Controls:
  * 1: Quick job (prints hello)
- * 2: Long job (3 seconds)
+ * 2: Long job (3 seconds, coroutine)
  * 3: Random addition
- * 4: Multiple prints
+ * 4: Multiple prints (coroutine)
+ * 5: Multiple random tasks
+ * 6: Priority lanes demo (long tasks on the Low lane, capped to 2 workers)
+ * 7: Telemetry snapshot (JSON)
+ * 8: Wake latency benchmark (Park vs SpinThenPark vs YieldThenPark)
+ * 9: 10000 concurrent coroutine waits
+ * 0: Delayed and periodic jobs
+ * g: Job groups (one cancelled fan-out next to one that completes)
+ * e: Elastic workers (fixed vs elastic pool with blocked workers)
+ * p: Monte Carlo pi (per-worker random engines and scratch memory)
+ * f: Parallel for / reduce / scan over 10M elements
  * q: Quit
  */
 int main()
 {
-    WorkerPool pool;
+    WorkerPoolConfig config;
+    config.laneWorkerLimits[static_cast<size_t>(JobPriority::Low)] = 2;
+    config.maxWorkerCount = 2 * std::max(2u, std::thread::hardware_concurrency());
+    config.logLevel = LogLevel::Debug;
+    WorkerPool pool(config);
 
     std::cout << "Controls:\n";
     std::cout << "1: Quick job (prints hello)\n";
@@ -164,11 +574,19 @@ int main()
     std::cout << "3: Random addition\n";
     std::cout << "4: Multiple prints\n";
     std::cout << "5: Multiple random tasks\n";
+    std::cout << "6: Priority lanes demo\n";
+    std::cout << "7: Telemetry snapshot\n";
+    std::cout << "8: Wake latency benchmark\n";
+    std::cout << "9: Concurrent coroutine waits\n";
+    std::cout << "0: Delayed and periodic jobs\n";
+    std::cout << "g: Job groups and cancellation\n";
+    std::cout << "e: Elastic worker count\n";
+    std::cout << "p: Monte Carlo pi (worker context)\n";
+    std::cout << "f: Parallel algorithms\n";
     std::cout << "q: Quit\n\n";
 
     std::random_device rd;
     std::mt19937 gen(rd());
-    std::uniform_int_distribution<> dis(1, 100);
 
     while (pool.IsRunning())
     {
@@ -186,7 +604,7 @@ int main()
                 break;
 
             case '3':
-                LunchMathTask(pool, dis, gen);
+                LunchMathTask(pool);
                 break;
 
             case '4':
@@ -194,7 +612,47 @@ int main()
                 break;
 
             case '5':
-                LaunchMultipleRandomTasks(pool, dis, gen, 100);
+                LaunchMultipleRandomTasks(pool, gen, 100);
+                break;
+
+            case '6':
+                LaunchPriorityMix(pool, 8, 50);
+                break;
+
+            case '7':
+                PrintTelemetry(pool);
+                break;
+
+            case '8':
+                RunWakeLatencyBenchmark(2000, std::chrono::microseconds(50));
+                break;
+
+            case '9':
+                LaunchConcurrentWaits(pool, 10000);
+                break;
+
+            case '0':
+                LaunchTimersDemo(pool);
+                break;
+
+            case 'g':
+            case 'G':
+                LaunchGroupCancellation(pool, 200);
+                break;
+
+            case 'e':
+            case 'E':
+                RunElasticDemo(100);
+                break;
+
+            case 'p':
+            case 'P':
+                LaunchMonteCarloPi(pool, 256, 100000);
+                break;
+
+            case 'f':
+            case 'F':
+                LaunchParallelAlgorithms(pool, 10'000'000);
                 break;
 
             case 'q':
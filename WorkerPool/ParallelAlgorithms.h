@@ -0,0 +1,162 @@
+#pragma once
+
+#include "ParallelChunks.h"
+#include "WorkerPool.h"
+
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <cstddef>
+#include <vector>
+
+/**
+ * Data-parallel algorithms running on a WorkerPool's threads
+ *
+ * The range is cut into chunks run by recursive splitting (see ParallelChunks): with grainSize 0 the
+ * chunk size adapts to the range and the worker count, otherwise chunks hold at most grainSize
+ * elements. The calling thread takes part and the call returns once the whole range is done, so
+ * the algorithms can be called from outside the pool as well as from inside a job. Reductions and
+ * scans combine the chunks in order: op only has to be associative, and the result does not depend
+ * on which thread ran which chunk.
+ */
+
+/**
+ * @brief Calls body(rangeBegin, rangeEnd) on disjoint sub-ranges covering [begin, end).
+ *
+ * The body gets a whole sub-range rather than one index, so its inner loop stays simple enough to vectorize.
+ */
+template <typename F>
+void ParallelFor(WorkerPool& pool, size_t begin, size_t end, F&& body, size_t grainSize = 0)
+{
+    const size_t count = end > begin ? end - begin : 0;
+    ParallelChunks::Run(pool, count, ParallelChunks::GetChunkCount(pool, count, grainSize),
+                        [begin, &body](size_t chunkBegin, size_t chunkEnd, size_t)
+    {
+        body(begin + chunkBegin, begin + chunkEnd);
+    });
+}
+
+/**
+ * @brief Reduces [begin, end): reduceRange(rangeBegin, rangeEnd) reduces one sub-range, combine merges two results.
+ *
+ * @return combine applied from identity over the sub-range results, in range order (identity for an empty range)
+ */
+template <typename T, typename ReduceRange, typename Combine>
+T ParallelReduce(WorkerPool& pool, size_t begin, size_t end, T identity, ReduceRange&& reduceRange, Combine&& combine,
+                 size_t grainSize = 0)
+{
+    const size_t count = end > begin ? end - begin : 0;
+    const size_t chunkCount = ParallelChunks::GetChunkCount(pool, count, grainSize);
+    std::vector<std::optional<T>> partials(chunkCount);
+
+    ParallelChunks::Run(pool, count, chunkCount, [begin, &reduceRange, &partials](size_t chunkBegin, size_t chunkEnd, size_t chunk)
+    {
+        partials[chunk].emplace(reduceRange(begin + chunkBegin, begin + chunkEnd));
+    });
+
+    T result = std::move(identity);
+    for (std::optional<T>& partial : partials)
+    {
+        result = combine(std::move(result), std::move(*partial));
+    }
+    return result;
+}
+
+/**
+ * @brief Writes the inclusive scan of [first, last) to dFirst: element i is op applied over elements 0 to i.
+ *
+ * Two passes over the chunks: the first reduces each chunk, the chunk totals are then scanned on the calling
+ * thread, and the second pass scans each chunk again starting from the total of the chunks before it. The
+ * output may be the input (in-place scan).
+ *
+ * @return Iterator past the last element written
+ */
+template <typename InputIt, typename OutputIt, typename Op = std::plus<>>
+OutputIt ParallelInclusiveScan(WorkerPool& pool, InputIt first, InputIt last, OutputIt dFirst, Op op = {}, size_t grainSize = 0)
+{
+    static_assert(std::random_access_iterator<InputIt> && std::random_access_iterator<OutputIt>,
+                  "Chunks are accessed by index");
+    using T = std::iter_value_t<InputIt>;
+
+    const size_t count = static_cast<size_t>(last - first);
+    const size_t chunkCount = ParallelChunks::GetChunkCount(pool, count, grainSize);
+    std::vector<std::optional<T>> offsets(chunkCount);
+
+    ParallelChunks::Run(pool, count, chunkCount, [first, &op, &offsets](size_t chunkBegin, size_t chunkEnd, size_t chunk)
+    {
+        T total = first[chunkBegin];
+        for (size_t i = chunkBegin + 1; i < chunkEnd; i++)
+        {
+            total = op(std::move(total), first[i]);
+        }
+        offsets[chunk].emplace(std::move(total));
+    });
+
+    std::optional<T> runningTotal;
+    for (std::optional<T>& offset : offsets)
+    {
+        T chunkTotal = std::move(*offset);
+        offset = runningTotal;
+        runningTotal = runningTotal ? op(std::move(*runningTotal), std::move(chunkTotal)) : std::move(chunkTotal);
+    }
+
+    ParallelChunks::Run(pool, count, chunkCount, [first, dFirst, &op, &offsets](size_t chunkBegin, size_t chunkEnd, size_t chunk)
+    {
+        T total = offsets[chunk] ? op(std::move(*offsets[chunk]), first[chunkBegin]) : T(first[chunkBegin]);
+        dFirst[chunkBegin] = total;
+        for (size_t i = chunkBegin + 1; i < chunkEnd; i++)
+        {
+            total = op(std::move(total), first[i]);
+            dFirst[i] = total;
+        }
+    });
+    return dFirst + count;
+}
+
+/**
+ * @brief Writes the exclusive scan of [first, last) to dFirst: element i is op applied from init over elements 0 to i - 1.
+ *
+ * Same two passes as ParallelInclusiveScan. The output may be the input (in-place scan).
+ *
+ * @return Iterator past the last element written
+ */
+template <typename InputIt, typename OutputIt, typename T, typename Op = std::plus<>>
+OutputIt ParallelExclusiveScan(WorkerPool& pool, InputIt first, InputIt last, OutputIt dFirst, T init, Op op = {}, size_t grainSize = 0)
+{
+    static_assert(std::random_access_iterator<InputIt> && std::random_access_iterator<OutputIt>,
+                  "Chunks are accessed by index");
+
+    const size_t count = static_cast<size_t>(last - first);
+    const size_t chunkCount = ParallelChunks::GetChunkCount(pool, count, grainSize);
+    std::vector<std::optional<T>> offsets(chunkCount);
+
+    ParallelChunks::Run(pool, count, chunkCount, [first, &op, &offsets](size_t chunkBegin, size_t chunkEnd, size_t chunk)
+    {
+        T total = first[chunkBegin];
+        for (size_t i = chunkBegin + 1; i < chunkEnd; i++)
+        {
+            total = op(std::move(total), first[i]);
+        }
+        offsets[chunk].emplace(std::move(total));
+    });
+
+    T runningTotal = std::move(init);
+    for (std::optional<T>& offset : offsets)
+    {
+        T chunkTotal = std::move(*offset);
+        offset = runningTotal;
+        runningTotal = op(std::move(runningTotal), std::move(chunkTotal));
+    }
+
+    ParallelChunks::Run(pool, count, chunkCount, [first, dFirst, &op, &offsets](size_t chunkBegin, size_t chunkEnd, size_t chunk)
+    {
+        T total = std::move(*offsets[chunk]);
+        for (size_t i = chunkBegin; i < chunkEnd; i++)
+        {
+            T value = first[i];
+            dFirst[i] = total;
+            total = op(std::move(total), std::move(value));
+        }
+    });
+    return dFirst + count;
+}
@@ -0,0 +1,79 @@
+#include "ParallelChunks.h"
+
+#include <algorithm>
+
+/**
+ * @brief Construct a new Parallel Chunks:: Parallel Chunks object
+ *
+ * @param count Size of the range
+ * @param chunkCount Number of chunks the range is cut into (at most count)
+ */
+ParallelChunks::ParallelChunks(WorkerPool& pool, size_t count, size_t chunkCount)
+    : pool(pool), count(count), chunkCount(chunkCount), pieces(std::make_unique<Piece[]>(chunkCount)), remainingChunks(chunkCount)
+{
+}
+
+/**
+ * @brief Get the number of chunks to cut a range of count elements into.
+ *
+ * With a grain size, chunks hold at most grainSize elements. With 0, the grain adapts to the range and the
+ * pool: ChunksPerThread chunks for each worker and the calling thread, so a worker that falls behind leaves
+ * the others enough chunks to stay busy, but never more chunks than elements.
+ */
+size_t ParallelChunks::GetChunkCount(const WorkerPool& pool, size_t count, size_t grainSize)
+{
+    if (grainSize != 0)
+    {
+        return (count + grainSize - 1) / grainSize;
+    }
+
+    const size_t threadCount = static_cast<size_t>(std::max(pool.GetWorkerCount(), 0)) + 1;
+    return std::min(count, threadCount * ChunksPerThread);
+}
+
+/**
+ * @brief Get the first element of a chunk; chunkCount gives the end of the range.
+ *
+ * The first count % chunkCount chunks hold one more element than the others.
+ */
+size_t ParallelChunks::GetChunkBegin(size_t chunk) const
+{
+    return chunk * (count / chunkCount) + std::min(chunk, count % chunkCount);
+}
+
+/**
+ * @brief Takes a published piece for the calling thread.
+ *
+ * @return false if the piece was not published yet or was already claimed
+ */
+bool ParallelChunks::TryClaim(size_t firstChunk)
+{
+    std::atomic<PieceStatus>& status = pieces[firstChunk].status;
+    PieceStatus expected = PieceStatus::Published;
+    return status.load(std::memory_order_relaxed) == PieceStatus::Published
+           && status.compare_exchange_strong(expected, PieceStatus::Claimed, std::memory_order_acquire);
+}
+
+/**
+ * @brief Keeps the exception being handled if it is the first one, and skips the chunks not started yet.
+ */
+void ParallelChunks::RecordException()
+{
+    std::scoped_lock lock(exceptionMutex);
+    if (!exception)
+    {
+        exception = std::current_exception();
+    }
+    failed.store(true, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Rethrows the first exception thrown by a chunk, if any.
+ */
+void ParallelChunks::RethrowException()
+{
+    if (failed.load(std::memory_order_relaxed))
+    {
+        std::rethrow_exception(exception);
+    }
+}
@@ -0,0 +1,170 @@
+#pragma once
+
+#include "WorkerPool.h"
+
+#include <exception>
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <mutex>
+
+/**
+ * @brief Runs the chunks of a range on a pool by recursive splitting (shared by ParallelAlgorithms.h)
+ *
+ * The range [0, count) is cut into chunkCount balanced chunks. The calling thread takes the whole
+ * range, and while it holds more than one chunk it publishes its upper half as a piece and queues a
+ * job for it, keeping the lower half; whoever runs a piece splits it the same way. Halving keeps big
+ * pieces in the queues for idle workers to steal and small ones local, and only as many jobs are
+ * queued as there are chunks. A piece is claimed atomically, either by its job or by the calling
+ * thread: once its own chunks are done, the caller takes back the pieces no worker has started
+ * instead of blocking, so it never waits on the queue (a busy pool, a lane limit, or a call made
+ * from inside a job cannot deadlock it) and only waits for chunks already running elsewhere.
+ *
+ * The state is shared with the queued jobs, since a job whose piece was taken back can run after
+ * the call returned. The first exception thrown by a chunk is rethrown by Run once every chunk is
+ * done; the chunks that had not started by then are skipped.
+ */
+class ParallelChunks
+{
+public:
+
+    //////// CONSTANTS ////////
+    static constexpr size_t ChunksPerThread = 8;
+
+    //////// CONSTRUCTOR ////////
+    ParallelChunks(WorkerPool& pool, size_t count, size_t chunkCount);
+
+	//////// DELETED METHODS ////////
+    ParallelChunks(const ParallelChunks&) = delete;
+    ParallelChunks& operator=(const ParallelChunks&) = delete;
+
+	//////// STATIC METHODS ////////
+    [[nodiscard]] static size_t GetChunkCount(const WorkerPool& pool, size_t count, size_t grainSize);
+    template <typename F>
+    static void Run(WorkerPool& pool, size_t count, size_t chunkCount, F&& chunkBody);
+
+	//////// METHODS ////////
+    [[nodiscard]] size_t GetChunkBegin(size_t chunk) const;
+
+private:
+
+    //////// STRUCTS ////////
+    enum class PieceStatus : uint8_t
+    {
+        None,
+        Published,
+        Claimed
+    };
+
+    struct Piece
+    {
+        std::atomic<PieceStatus> status = PieceStatus::None;
+        size_t lastChunk = 0;
+    };
+
+	//////// METHODS ////////
+    template <typename F>
+    static void Split(const std::shared_ptr<ParallelChunks>& self, F& chunkBody, size_t firstChunk, size_t lastChunk);
+    template <typename F>
+    void RunChunk(F& chunkBody, size_t chunk);
+    bool TryClaim(size_t firstChunk);
+    void RecordException();
+    void RethrowException();
+
+    //////// FIELDS ////////
+    WorkerPool& pool;
+    size_t count;
+    size_t chunkCount;
+    std::unique_ptr<Piece[]> pieces;
+    std::atomic<size_t> remainingChunks;
+    std::atomic<bool> failed = false;
+    std::exception_ptr exception;
+    std::mutex exceptionMutex;
+};
+
+/**
+ * @brief Calls chunkBody(begin, end, chunk) once for each of the chunkCount chunks of [0, count).
+ *
+ * Returns once every chunk is done. The calling thread runs chunks too: a single chunk never leaves it.
+ */
+template <typename F>
+void ParallelChunks::Run(WorkerPool& pool, size_t count, size_t chunkCount, F&& chunkBody)
+{
+    if (chunkCount == 0)
+    {
+        return;
+    }
+
+    auto self = std::make_shared<ParallelChunks>(pool, count, chunkCount);
+    Split(self, chunkBody, 0, chunkCount);
+
+    while (self->remainingChunks.load(std::memory_order_acquire) > 0)
+    {
+        bool claimed = false;
+        for (size_t firstChunk = 1; firstChunk < chunkCount; firstChunk++)
+        {
+            if (self->TryClaim(firstChunk))
+            {
+                Split(self, chunkBody, firstChunk, self->pieces[firstChunk].lastChunk);
+                claimed = true;
+            }
+        }
+
+        if (!claimed)
+        {
+            std::this_thread::yield();
+        }
+    }
+    self->RethrowException();
+}
+
+/**
+ * @brief Runs chunks firstChunk to lastChunk - 1, publishing and queueing their upper half while more than one is left.
+ *
+ * Piece firstChunk is indexed by its first chunk: every chunk but 0 starts at most one piece. A piece whose job
+ * the pool rejects stays published, so the calling thread still takes it back.
+ */
+template <typename F>
+void ParallelChunks::Split(const std::shared_ptr<ParallelChunks>& self, F& chunkBody, size_t firstChunk, size_t lastChunk)
+{
+    while (lastChunk - firstChunk > 1)
+    {
+        const size_t middleChunk = firstChunk + (lastChunk - firstChunk) / 2;
+        Piece& piece = self->pieces[middleChunk];
+        piece.lastChunk = lastChunk;
+        piece.status.store(PieceStatus::Published, std::memory_order_release);
+
+        self->pool.AddJob([self, &chunkBody, middleChunk]
+        {
+            if (self->TryClaim(middleChunk))
+            {
+                Split(self, chunkBody, middleChunk, self->pieces[middleChunk].lastChunk);
+            }
+        });
+        lastChunk = middleChunk;
+    }
+
+    self->RunChunk(chunkBody, firstChunk);
+}
+
+/**
+ * @brief Runs one chunk, unless an earlier chunk threw, and counts it as done.
+ */
+template <typename F>
+void ParallelChunks::RunChunk(F& chunkBody, size_t chunk)
+{
+    if (!failed.load(std::memory_order_relaxed))
+    {
+        try
+        {
+            chunkBody(GetChunkBegin(chunk), GetChunkBegin(chunk + 1), chunk);
+        }
+        catch (...)
+        {
+            RecordException();
+        }
+    }
+    remainingChunks.fetch_sub(1, std::memory_order_acq_rel);
+}
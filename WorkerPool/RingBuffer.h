@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Growable circular buffer usable as a queue or a deque
+ *
+ * Unlike std::deque, which allocates and frees a chunk every few hundred pushes,
+ * the storage only grows (doubling) and is reused afterwards, so a queue that has
+ * reached its working size performs no allocation. Not thread-safe.
+ */
+template <typename T>
+class RingBuffer
+{
+public:
+
+    //////// METHODS ////////
+    //// Access
+    void PushBack(T&& item)
+    {
+        if (count == slots.size())
+        {
+            Grow();
+        }
+
+        slots[(head + count) & (slots.size() - 1)] = std::move(item);
+        count++;
+    }
+
+    T PopFront()
+    {
+        T item = std::move(slots[head]);
+        head = (head + 1) & (slots.size() - 1);
+        count--;
+        return item;
+    }
+
+    T PopBack()
+    {
+        count--;
+        return std::move(slots[(head + count) & (slots.size() - 1)]);
+    }
+
+    //// Helpers
+    void Clear()
+    {
+        while (count > 0)
+        {
+            PopFront();
+        }
+        head = 0;
+    }
+
+    [[nodiscard]] bool Empty() const { return count == 0; }
+    [[nodiscard]] size_t Size() const { return count; }
+
+private:
+
+	//////// METHODS ////////
+    void Grow()
+    {
+        std::vector<T> grown(slots.empty() ? InitialCapacity : slots.size() * 2);
+        for (size_t i = 0; i < count; i++)
+        {
+            grown[i] = std::move(slots[(head + i) & (slots.size() - 1)]);
+        }
+
+        slots.swap(grown);
+        head = 0;
+    }
+
+    //////// CONSTANTS ////////
+    static constexpr size_t InitialCapacity = 64;
+
+    //////// FIELDS ////////
+    std::vector<T> slots;
+    size_t head = 0;
+    size_t count = 0;
+};
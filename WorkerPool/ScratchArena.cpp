@@ -0,0 +1,120 @@
+#include "ScratchArena.h"
+
+#include <algorithm>
+#include <cstdint>
+
+/**
+ * @brief Construct a new Scratch Arena:: Scratch Arena object
+ *
+ * @param initialCapacity Size of the first block, allocated on the first Allocate
+ */
+ScratchArena::ScratchArena(size_t initialCapacity) : initialCapacity(std::max<size_t>(initialCapacity, 1))
+{
+}
+
+/**
+ * @brief Allocates size bytes aligned on alignment (a power of two).
+ *
+ * The memory stays valid until Reset, or until a Rewind to a marker taken before this call.
+ */
+void* ScratchArena::Allocate(size_t size, size_t alignment)
+{
+    for (; currentBlock < blocks.size(); currentBlock++)
+    {
+        if (void* memory = TryAllocate(blocks[currentBlock], size, alignment))
+        {
+            return memory;
+        }
+        offset = 0;
+    }
+
+    const size_t largestBlock = blocks.empty() ? initialCapacity / 2 : blocks.back().size;
+    Block& block = blocks.emplace_back();
+    block.size = std::max(largestBlock * 2, size + alignment);
+    block.memory = std::make_unique_for_overwrite<std::byte[]>(block.size);
+    currentBlock = blocks.size() - 1;
+    offset = 0;
+    return TryAllocate(block, size, alignment);
+}
+
+/**
+ * @brief Frees everything allocated so far.
+ *
+ * Blocks are kept; several blocks are merged into one of their total size.
+ */
+void ScratchArena::Reset()
+{
+    if (blocks.size() > 1)
+    {
+        const size_t totalSize = GetCapacity();
+        blocks.clear();
+        Block& block = blocks.emplace_back();
+        block.size = totalSize;
+        block.memory = std::make_unique_for_overwrite<std::byte[]>(totalSize);
+    }
+
+    currentBlock = 0;
+    offset = 0;
+}
+
+/**
+ * @brief Get the current allocation point, to free everything allocated after it with Rewind.
+ */
+ScratchArena::Marker ScratchArena::GetMarker() const
+{
+    return { currentBlock, offset };
+}
+
+/**
+ * @brief Frees everything allocated since a marker was taken, after the last Reset (blocks are kept).
+ */
+void ScratchArena::Rewind(const Marker& marker)
+{
+    currentBlock = marker.block;
+    offset = marker.offset;
+}
+
+/**
+ * @brief Get the number of bytes handed out since the last Reset, alignment padding included.
+ */
+size_t ScratchArena::GetUsed() const
+{
+    size_t used = offset;
+    for (size_t block = 0; block < currentBlock && block < blocks.size(); block++)
+    {
+        used += blocks[block].size;
+    }
+    return used;
+}
+
+/**
+ * @brief Get the total size of the blocks owned by the arena.
+ */
+size_t ScratchArena::GetCapacity() const
+{
+    size_t capacity = 0;
+    for (const Block& block : blocks)
+    {
+        capacity += block.size;
+    }
+    return capacity;
+}
+
+/**
+ * @brief Bumps the offset within a block, if the aligned allocation fits.
+ *
+ * @return nullptr if the block is too small
+ */
+void* ScratchArena::TryAllocate(Block& block, size_t size, size_t alignment)
+{
+    const uintptr_t base = reinterpret_cast<uintptr_t>(block.memory.get());
+    const uintptr_t aligned = (base + offset + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+    const size_t end = static_cast<size_t>(aligned - base) + size;
+    if (end > block.size)
+    {
+        return nullptr;
+    }
+
+    offset = end;
+    return reinterpret_cast<void*>(aligned);
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <type_traits>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Bump allocator for a job's temporary memory (not thread-safe, one per worker)
+ *
+ * Allocating only moves an offset forward; nothing is freed individually. Reset rewinds
+ * the whole arena, and a marker rewinds it to an earlier point. When a block is full a
+ * larger one is appended; on Reset, an arena that needed several blocks is merged into a
+ * single block of their total size, so it stops allocating once it has seen its peak usage.
+ * Blocks are only allocated on first use.
+ */
+class ScratchArena
+{
+public:
+
+    //////// STRUCTS ////////
+    struct Marker
+    {
+        size_t block = 0;
+        size_t offset = 0;
+    };
+
+    //////// CONSTANTS ////////
+    static constexpr size_t DefaultCapacity = 64 * 1024;
+
+    //////// CONSTRUCTOR ////////
+    explicit ScratchArena(size_t initialCapacity = DefaultCapacity);
+
+	//////// DELETED METHODS ////////
+    ScratchArena(const ScratchArena&) = delete;
+    ScratchArena& operator=(const ScratchArena&) = delete;
+
+	//////// METHODS ////////
+    void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+    template <typename T>
+    T* AllocateArray(size_t count);
+    void Reset();
+
+    //// Markers
+    [[nodiscard]] Marker GetMarker() const;
+    void Rewind(const Marker& marker);
+
+    //// Helpers
+    [[nodiscard]] size_t GetUsed() const;
+    [[nodiscard]] size_t GetCapacity() const;
+
+private:
+
+    //////// STRUCTS ////////
+    struct Block
+    {
+        std::unique_ptr<std::byte[]> memory;
+        size_t size = 0;
+    };
+
+	//////// METHODS ////////
+    void* TryAllocate(Block& block, size_t size, size_t alignment);
+
+    //////// FIELDS ////////
+    size_t initialCapacity;
+    std::vector<Block> blocks;
+    size_t currentBlock = 0;
+    size_t offset = 0;
+};
+
+/**
+ * @brief Allocates uninitialized room for count objects of type T.
+ *
+ * The arena never runs destructors, so T must be trivially destructible.
+ */
+template <typename T>
+T* ScratchArena::AllocateArray(size_t count)
+{
+    static_assert(std::is_trivially_destructible_v<T>, "Scratch memory is released without running destructors");
+    return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+}
@@ -0,0 +1,140 @@
+#include "TaskHandle.h"
+#include "WorkerPool.h"
+
+/**
+ * @brief Construct a new Task State Base:: Task State Base object
+ *
+ * @param pool Pool that runs the task and its continuations
+ */
+TaskStateBase::TaskStateBase(WorkerPool* pool) : pool(pool)
+{
+}
+
+/**
+ * @brief Checks whether the task has completed (successfully or not).
+ */
+bool TaskStateBase::IsReady() const
+{
+    std::scoped_lock lock(stateMutex);
+    return completed;
+}
+
+/**
+ * @brief Blocks the calling thread until the task has completed.
+ *
+ * Meant for threads outside the pool: a worker waiting here holds its thread for nothing,
+ * use dependencies or continuations instead.
+ */
+void TaskStateBase::Wait() const
+{
+    std::unique_lock lock(stateMutex);
+    completedCondition.wait(lock, [this]
+    {
+        return completed;
+    });
+}
+
+/**
+ * @brief Registers a callback to run once the task has completed.
+ *
+ * If the task is already done, the callback runs immediately on the calling thread.
+ * Otherwise it runs on the thread that completes the task.
+ */
+void TaskStateBase::OnCompleted(std::function<void()> continuation)
+{
+    {
+        std::scoped_lock lock(stateMutex);
+        if (!completed)
+        {
+            continuations.push_back(std::move(continuation));
+            return;
+        }
+    }
+
+    continuation();
+}
+
+/**
+ * @brief Queues a job on the pool as soon as every dependency has completed.
+ *
+ * A shared counter starts at the number of dependencies plus one. Each dependency decrements it
+ * from its completion callback, and this method releases the extra reference last, so the job is
+ * added exactly once, by whichever thread finishes the last dependency, without anyone blocking.
+ * Task jobs are never rejected by a full bounded queue: they run inline instead, so handles always complete.
+ */
+void TaskStateBase::ScheduleAfter(WorkerPool* pool, const std::vector<TaskDependency>& dependencies, Job job)
+{
+    struct PendingJob
+    {
+        std::atomic<size_t> remainingDependencies;
+        Job job;
+    };
+
+    auto pending = std::make_shared<PendingJob>();
+    pending->remainingDependencies = dependencies.size() + 1;
+    pending->job = std::move(job);
+
+    auto release = [pool, pending]
+    {
+        if (--pending->remainingDependencies == 0)
+        {
+            pool->PushJob(std::move(pending->job), false);
+        }
+    };
+
+    for (const TaskDependency& dependency : dependencies)
+    {
+        dependency.GetState()->OnCompleted(release);
+    }
+
+    release();
+}
+
+/**
+ * @brief Get the pool this task was submitted to.
+ */
+WorkerPool* TaskStateBase::GetPool() const
+{
+    return pool;
+}
+
+/**
+ * @brief Get the exception thrown by the task, or nullptr if it succeeded (or has not run yet).
+ */
+std::exception_ptr TaskStateBase::GetException() const
+{
+    std::scoped_lock lock(stateMutex);
+    return exception;
+}
+
+/**
+ * @brief Stores the exception thrown by the task body.
+ */
+void TaskStateBase::SetException(std::exception_ptr taskException)
+{
+    std::scoped_lock lock(stateMutex);
+    exception = taskException;
+}
+
+/**
+ * @brief Marks the task as completed, wakes blocked waiters and runs the registered continuations.
+ *
+ * Continuations are moved out of the state under the lock and run after releasing it,
+ * so a continuation is free to register further continuations on this same task.
+ */
+void TaskStateBase::MarkCompleted()
+{
+    std::vector<std::function<void()>> readyContinuations;
+
+    {
+        std::scoped_lock lock(stateMutex);
+        completed = true;
+        readyContinuations.swap(continuations);
+    }
+    completedCondition.notify_all();
+
+    for (std::function<void()>& continuation : readyContinuations)
+    {
+        continuation();
+    }
+}
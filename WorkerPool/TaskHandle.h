@@ -0,0 +1,281 @@
+#pragma once
+
+#include "Job.h"
+
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+class WorkerPool;
+class TaskDependency;
+
+/**
+ * @brief Type-independent part of a task's shared state
+ *
+ * Tracks completion, lets threads block until the task is done, and keeps the list
+ * of continuations to run when it completes. Continuations run on the thread that
+ * completes the task and are only used to schedule follow-up jobs, so no worker
+ * ever blocks waiting for another task.
+ */
+class TaskStateBase
+{
+public:
+
+    //////// CONSTRUCTOR ////////
+    explicit TaskStateBase(WorkerPool* pool);
+    virtual ~TaskStateBase() = default;
+
+	//////// DELETED METHODS ////////
+    TaskStateBase(const TaskStateBase&) = delete;
+    TaskStateBase& operator=(const TaskStateBase&) = delete;
+
+	//////// METHODS ////////
+    //// Completion
+    [[nodiscard]] bool IsReady() const;
+    void Wait() const;
+    void OnCompleted(std::function<void()> continuation);
+
+    //// Scheduling
+    static void ScheduleAfter(WorkerPool* pool, const std::vector<TaskDependency>& dependencies, Job job);
+
+    //// Helpers
+    [[nodiscard]] WorkerPool* GetPool() const;
+    [[nodiscard]] std::exception_ptr GetException() const;
+
+protected:
+
+	//////// METHODS ////////
+    void SetException(std::exception_ptr taskException);
+    void MarkCompleted();
+
+private:
+
+    //////// FIELDS ////////
+    WorkerPool* pool;
+    std::exception_ptr exception;
+    bool completed = false;
+    std::vector<std::function<void()>> continuations;
+    mutable std::mutex stateMutex;
+    mutable std::condition_variable completedCondition;
+};
+
+/**
+ * @brief Shared state of a task producing a value of type T
+ */
+template <typename T>
+class TaskState : public TaskStateBase
+{
+public:
+
+    //////// TYPES ////////
+    using StoredType = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+
+    //////// CONSTRUCTOR ////////
+    using TaskStateBase::TaskStateBase;
+
+	//////// METHODS ////////
+    /**
+     * @brief Runs the task body, stores its result (or exception) and completes the task
+     */
+    template <typename F>
+    void Run(F& function)
+    {
+        try
+        {
+            if constexpr (std::is_void_v<T>)
+            {
+                function();
+                result.emplace();
+            }
+            else
+            {
+                result.emplace(function());
+            }
+        }
+        catch (...)
+        {
+            SetException(std::current_exception());
+        }
+
+        MarkCompleted();
+    }
+
+    /**
+     * @brief Completes the task with an exception without running anything
+     */
+    void Fail(std::exception_ptr taskException)
+    {
+        SetException(taskException);
+        MarkCompleted();
+    }
+
+    /**
+     * @brief Returns the stored result, rethrowing the task's exception if it failed
+     *
+     * Must only be called once the task is ready.
+     */
+    const StoredType& GetResult() const
+    {
+        if (std::exception_ptr taskException = GetException())
+        {
+            std::rethrow_exception(taskException);
+        }
+        return *result;
+    }
+
+private:
+
+    //////// FIELDS ////////
+    std::optional<StoredType> result;
+};
+
+/**
+ * @brief Future-like handle to a job submitted through WorkerPool::Submit
+ *
+ * Handles are cheap to copy and share the same task. Get() blocks the calling
+ * thread, so it is meant for code outside the pool; inside the pool, chain work
+ * with Then() or pass the handle as a dependency to WorkerPool::Submit instead.
+ */
+template <typename T>
+class TaskHandle
+{
+public:
+
+    //////// TYPES ////////
+    using ResultType = std::conditional_t<std::is_void_v<T>, void, std::add_lvalue_reference_t<const T>>;
+
+    //////// CONSTRUCTOR ////////
+    TaskHandle() = default;
+    explicit TaskHandle(std::shared_ptr<TaskState<T>> state) : state(std::move(state)) {}
+
+	//////// METHODS ////////
+    [[nodiscard]] bool IsValid() const { return state != nullptr; }
+    [[nodiscard]] bool IsReady() const { return state->IsReady(); }
+    void Wait() const { state->Wait(); }
+
+    /**
+     * @brief Waits for the task and returns its result, rethrowing its exception if it failed
+     */
+    ResultType Get() const
+    {
+        state->Wait();
+        if constexpr (std::is_void_v<T>)
+        {
+            state->GetResult();
+        }
+        else
+        {
+            return state->GetResult();
+        }
+    }
+
+    /**
+     * @brief Schedules a continuation that receives this task's result once it is ready
+     *
+     * For TaskHandle<void> the continuation takes no argument. If this task failed,
+     * the continuation is skipped and the returned handle carries the same exception.
+     */
+    template <typename F>
+    auto Then(F&& continuation) const
+    {
+        using ContinuationResult = typename std::conditional_t<std::is_void_v<T>,
+            std::invoke_result<std::decay_t<F>>,
+            std::invoke_result<std::decay_t<F>, const T&>>::type;
+
+        auto nextState = std::make_shared<TaskState<ContinuationResult>>(state->GetPool());
+        auto antecedent = state;
+
+        TaskStateBase::ScheduleAfter(state->GetPool(), { *this },
+            [nextState, antecedent, continuation = std::forward<F>(continuation)]() mutable
+            {
+                if (std::exception_ptr antecedentException = antecedent->GetException())
+                {
+                    nextState->Fail(antecedentException);
+                    return;
+                }
+
+                if constexpr (std::is_void_v<T>)
+                {
+                    nextState->Run(continuation);
+                }
+                else
+                {
+                    auto bound = [&]() -> ContinuationResult { return continuation(antecedent->GetResult()); };
+                    nextState->Run(bound);
+                }
+            });
+
+        return TaskHandle<ContinuationResult>(nextState);
+    }
+
+    /**
+     * @brief Suspends the awaiting coroutine until this task is ready, then yields a copy of its result
+     *
+     * The coroutine is resumed by a job queued on the task's pool once the task completes, so no
+     * worker waits in the meantime. Rethrows the task's exception if it failed.
+     */
+    auto operator co_await() const
+    {
+        struct Awaiter
+        {
+            std::shared_ptr<TaskState<T>> state;
+
+            bool await_ready() const { return state->IsReady(); }
+            void await_suspend(std::coroutine_handle<> awaiting) const
+            {
+                TaskStateBase::ScheduleAfter(state->GetPool(), { TaskHandle(state) }, Job([awaiting]() { awaiting.resume(); }));
+            }
+            T await_resume() const
+            {
+                if constexpr (std::is_void_v<T>)
+                {
+                    state->GetResult();
+                }
+                else
+                {
+                    return state->GetResult();
+                }
+            }
+        };
+        return Awaiter{ state };
+    }
+
+private:
+
+    //////// FIELDS ////////
+    std::shared_ptr<TaskState<T>> state;
+
+    friend class TaskDependency;
+};
+
+/**
+ * @brief Type-erased reference to a task another job depends on
+ *
+ * Implicitly built from any TaskHandle so dependencies of different result
+ * types can be listed together: pool.Submit(job, { filterTask, countTask }).
+ */
+class TaskDependency
+{
+public:
+
+    //////// CONSTRUCTOR ////////
+    template <typename T>
+    TaskDependency(const TaskHandle<T>& handle) : state(handle.state) {}
+
+	//////// METHODS ////////
+    [[nodiscard]] const std::shared_ptr<TaskStateBase>& GetState() const { return state; }
+
+private:
+
+    //////// FIELDS ////////
+    std::shared_ptr<TaskStateBase> state;
+};
@@ -0,0 +1,166 @@
+#include "TimerQueue.h"
+
+#include <algorithm>
+#include <chrono>
+
+/**
+ * @brief Construct a new Timer Queue:: Timer Queue object
+ *
+ * @param dispatch Called on the timer thread with each job whose deadline has passed
+ */
+TimerQueue::TimerQueue(DispatchFunction dispatch) : dispatch(std::move(dispatch)), wheel(NowTick())
+{
+    timerThread = std::jthread([this](std::stop_token stopToken)
+    {
+        Run(stopToken);
+    });
+}
+
+/**
+ * @brief Destroy the Timer Queue:: Timer Queue object
+ */
+TimerQueue::~TimerQueue()
+{
+    Stop();
+}
+
+/**
+ * @brief Schedules a one-shot job for a deadline (steady clock, nanoseconds since its epoch).
+ */
+TimerId TimerQueue::Add(int64_t dueTime, Job&& job)
+{
+    return AddTimer(dueTime, 0, std::move(job));
+}
+
+/**
+ * @brief Schedules a job to run at firstDueTime, then every period nanoseconds until cancelled.
+ *
+ * The period is rounded up to a whole number of ticks (at least one).
+ */
+TimerId TimerQueue::AddPeriodic(int64_t firstDueTime, int64_t period, Job&& job)
+{
+    return AddTimer(firstDueTime, std::max<int64_t>(period, 1), std::move(job));
+}
+
+/**
+ * @brief Cancels a pending timer in O(1).
+ *
+ * A run of a periodic timer that is already queued still executes.
+ *
+ * @return false if the timer already fired, was already cancelled or is unknown
+ */
+bool TimerQueue::Cancel(TimerId id)
+{
+    std::scoped_lock lock(timerMutex);
+    return wheel.Cancel(id);
+}
+
+/**
+ * @brief Stops the timer thread and drops the timers that have not fired.
+ *
+ * @return Number of dropped one-shot timers
+ */
+size_t TimerQueue::Stop()
+{
+    timerThread.request_stop();
+    if (timerThread.joinable())
+    {
+        timerThread.join();
+    }
+
+    std::scoped_lock lock(timerMutex);
+    return wheel.Clear();
+}
+
+/**
+ * @brief Get the number of pending timers (periodic timers included).
+ */
+size_t TimerQueue::Size() const
+{
+    std::scoped_lock lock(timerMutex);
+    return wheel.Size();
+}
+
+/**
+ * @brief Adds a timer to the wheel, waking the timer thread only if it now has to wake up earlier.
+ */
+TimerId TimerQueue::AddTimer(int64_t dueTime, int64_t period, Job&& job)
+{
+    const int64_t dueTick = (dueTime + TickNanoseconds - 1) / TickNanoseconds;
+    const int64_t periodTicks = (period + TickNanoseconds - 1) / TickNanoseconds;
+
+    TimerId id = 0;
+    bool wakeUp = false;
+    {
+        std::scoped_lock lock(timerMutex);
+        id = wheel.Add(dueTick, periodTicks, std::move(job));
+        if (dueTick < plannedWakeTick)
+        {
+            wakeRequested = true;
+            wakeUp = true;
+        }
+    }
+
+    if (wakeUp)
+    {
+        timerCondition.notify_one();
+    }
+    return id;
+}
+
+/**
+ * @brief Timer thread function.
+ *
+ * Advances the wheel to the current tick and dispatches the due jobs after releasing the lock, so Add and
+ * Cancel are never blocked by a dispatch. Then sleeps until the next tick holding timers, or until a timer
+ * due earlier is added.
+ */
+void TimerQueue::Run(std::stop_token stopToken)
+{
+    std::vector<Job> dueJobs;
+    std::vector<Job> periodicRuns;
+    std::unique_lock lock(timerMutex);
+
+    while (!stopToken.stop_requested())
+    {
+        wheel.Advance(NowTick(), dueJobs, periodicRuns);
+        if (!dueJobs.empty() || !periodicRuns.empty())
+        {
+            lock.unlock();
+            for (Job& job : dueJobs)
+            {
+                dispatch(job, false);
+            }
+            for (Job& job : periodicRuns)
+            {
+                dispatch(job, true);
+            }
+            dueJobs.clear();
+            periodicRuns.clear();
+            lock.lock();
+            continue;
+        }
+
+        plannedWakeTick = wheel.GetNextExpiryTick();
+        wakeRequested = false;
+
+        if (plannedWakeTick == INT64_MAX)
+        {
+            timerCondition.wait(lock, stopToken, [this] { return wakeRequested; });
+        }
+        else
+        {
+            const std::chrono::steady_clock::time_point wakeTime{ std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::nanoseconds(plannedWakeTick * TickNanoseconds)) };
+            timerCondition.wait_until(lock, stopToken, wakeTime, [this] { return wakeRequested; });
+        }
+        plannedWakeTick = INT64_MAX;
+    }
+}
+
+/**
+ * @brief Get the current tick of the steady clock.
+ */
+int64_t TimerQueue::NowTick()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count() / TickNanoseconds;
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "TimerWheel.h"
+#include "Job.h"
+
+#include <condition_variable>
+#include <functional>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <mutex>
+
+/**
+ * @brief Jobs waiting for a deadline, released by a dedicated timer thread
+ *
+ * Timers are kept in a hierarchical TimerWheel with a 1 ms tick, so adding and cancelling
+ * one is O(1) even with tens of thousands pending. The thread sleeps until the next tick
+ * holding timers and hands every due job to the dispatch callback, which queues it on the
+ * pool: no worker ever sleeps for a timer. Deadlines are rounded up to the next tick.
+ */
+class TimerQueue
+{
+public:
+
+    //////// TYPES ////////
+    using DispatchFunction = std::function<void(Job& job, bool periodic)>;
+
+    //////// CONSTANTS ////////
+    static constexpr int64_t TickNanoseconds = 1'000'000;
+
+    //////// CONSTRUCTOR ////////
+    explicit TimerQueue(DispatchFunction dispatch);
+    ~TimerQueue();
+
+	//////// DELETED METHODS ////////
+    TimerQueue(const TimerQueue&) = delete;
+    TimerQueue& operator=(const TimerQueue&) = delete;
+
+	//////// METHODS ////////
+    TimerId Add(int64_t dueTime, Job&& job);
+    TimerId AddPeriodic(int64_t firstDueTime, int64_t period, Job&& job);
+    bool Cancel(TimerId id);
+    size_t Stop();
+    [[nodiscard]] size_t Size() const;
+
+private:
+
+	//////// METHODS ////////
+    TimerId AddTimer(int64_t dueTime, int64_t period, Job&& job);
+    void Run(std::stop_token stopToken);
+
+	//////// STATIC METHODS ////////
+    static int64_t NowTick();
+
+    //////// FIELDS ////////
+    DispatchFunction dispatch;
+    TimerWheel wheel;
+    int64_t plannedWakeTick = INT64_MAX;
+    bool wakeRequested = false;
+    mutable std::mutex timerMutex;
+    std::condition_variable_any timerCondition;
+    std::jthread timerThread;
+};
@@ -0,0 +1,345 @@
+#include "TimerWheel.h"
+
+#include <algorithm>
+
+/**
+ * @brief Construct a new Timer Wheel:: Timer Wheel object
+ *
+ * @param startTick Tick the wheel starts at (timers due at or before it fire on the next tick)
+ */
+TimerWheel::TimerWheel(int64_t startTick) : currentTick(startTick)
+{
+    slotHeads.fill(InvalidIndex);
+}
+
+/**
+ * @brief Adds a timer.
+ *
+ * @param dueTick Tick of the (first) expiry; past ticks fire on the next tick
+ * @param periodTicks Ticks between runs of a periodic timer, 0 for a one-shot timer
+ * @return ID to pass to Cancel
+ */
+TimerId TimerWheel::Add(int64_t dueTick, int64_t periodTicks, Job&& job)
+{
+    uint32_t index = freeHead;
+    if (index != InvalidIndex)
+    {
+        freeHead = nodes[index].next;
+    }
+    else
+    {
+        index = static_cast<uint32_t>(nodes.size());
+        nodes.emplace_back();
+    }
+
+    Node& node = nodes[index];
+    node.dueTick = std::max(dueTick, currentTick + 1);
+    node.periodTicks = periodTicks;
+    if (periodTicks > 0)
+    {
+        node.periodic = std::make_shared<PeriodicJob>();
+        node.periodic->job = std::move(job);
+    }
+    else
+    {
+        node.job = std::move(job);
+        oneShotCount++;
+    }
+
+    timerCount++;
+    Link(index);
+
+    const TimerId id = (static_cast<uint64_t>(node.generation) << 32) | index;
+    return periodTicks > 0 ? id | PeriodicFlag : id;
+}
+
+/**
+ * @brief Cancels a pending timer in O(1).
+ *
+ * @return false if the timer already fired (one-shot), was already cancelled or the ID is unknown
+ */
+bool TimerWheel::Cancel(TimerId id)
+{
+    const uint32_t index = static_cast<uint32_t>(id);
+    const uint32_t generation = static_cast<uint32_t>((id & ~PeriodicFlag) >> 32);
+
+    if (index >= nodes.size() || nodes[index].generation != generation || nodes[index].slot == InvalidIndex)
+    {
+        return false;
+    }
+
+    Unlink(index);
+    Release(index);
+    return true;
+}
+
+/**
+ * @brief Moves the wheel forward to nowTick and collects the jobs of every timer that expired on the way.
+ *
+ * Ticks are processed one by one while level 0 holds timers; otherwise the wheel jumps straight to the next
+ * level-0 rotation, where higher levels may cascade, so an idle wheel costs nothing per tick.
+ *
+ * @param outDueJobs Receives the jobs of expired one-shot timers
+ * @param outPeriodicRuns Receives one run of each periodic timer that expired and is not still running
+ */
+void TimerWheel::Advance(int64_t nowTick, std::vector<Job>& outDueJobs, std::vector<Job>& outPeriodicRuns)
+{
+    while (currentTick < nowTick)
+    {
+        if (timerCount == 0)
+        {
+            currentTick = nowTick;
+            return;
+        }
+
+        if (levelCounts[0] == 0)
+        {
+            const int64_t nextRotation = ((currentTick >> SlotBits) + 1) << SlotBits;
+            if (nextRotation > nowTick)
+            {
+                currentTick = nowTick;
+                return;
+            }
+            currentTick = nextRotation;
+        }
+        else
+        {
+            currentTick++;
+        }
+
+        for (uint32_t level = LevelCount - 1; level >= 1; level--)
+        {
+            if ((currentTick & ((int64_t{ 1 } << (SlotBits * level)) - 1)) == 0)
+            {
+                Cascade(level);
+            }
+        }
+        Expire(outDueJobs, outPeriodicRuns);
+    }
+}
+
+/**
+ * @brief Removes every timer.
+ *
+ * @return Number of one-shot timers removed
+ */
+size_t TimerWheel::Clear()
+{
+    const size_t removed = oneShotCount;
+    for (uint32_t index = 0; index < nodes.size(); index++)
+    {
+        if (nodes[index].slot != InvalidIndex)
+        {
+            Unlink(index);
+            Release(index);
+        }
+    }
+    return removed;
+}
+
+/**
+ * @brief Get the tick at which Advance should be called next, INT64_MAX if there is no timer.
+ *
+ * That is the earliest level-0 expiry, or the next level-0 rotation if higher levels hold timers
+ * that may cascade (and possibly expire) before it.
+ */
+int64_t TimerWheel::GetNextExpiryTick() const
+{
+    if (timerCount == 0)
+    {
+        return INT64_MAX;
+    }
+
+    const int64_t nextRotation = ((currentTick >> SlotBits) + 1) << SlotBits;
+    if (levelCounts[0] == 0)
+    {
+        return nextRotation;
+    }
+
+    for (int64_t tick = currentTick + 1; tick < nextRotation; tick++)
+    {
+        if (slotHeads[static_cast<size_t>(tick & (SlotCount - 1))] != InvalidIndex)
+        {
+            return tick;
+        }
+    }
+    return nextRotation;
+}
+
+/**
+ * @brief Get the last tick the wheel was advanced to.
+ */
+int64_t TimerWheel::GetCurrentTick() const
+{
+    return currentTick;
+}
+
+/**
+ * @brief Get the number of pending timers (periodic timers included).
+ */
+size_t TimerWheel::Size() const
+{
+    return timerCount;
+}
+
+/**
+ * @brief Checks whether an ID was returned for a periodic timer.
+ */
+bool TimerWheel::IsPeriodic(TimerId id)
+{
+    return (id & PeriodicFlag) != 0;
+}
+
+/**
+ * @brief Inserts a node at the head of the slot matching its delay.
+ *
+ * Delays beyond the range of the last level are parked in the farthest slot and re-placed when it cascades.
+ */
+void TimerWheel::Link(uint32_t index)
+{
+    Node& node = nodes[index];
+    const int64_t delay = node.dueTick - currentTick;
+
+    uint32_t level = 0;
+    while (level + 1 < LevelCount && delay >= (int64_t{ 1 } << (SlotBits * (level + 1))))
+    {
+        level++;
+    }
+
+    const int64_t maxDelay = (int64_t{ 1 } << (SlotBits * LevelCount)) - 1;
+    const int64_t placementTick = delay > maxDelay ? currentTick + maxDelay : node.dueTick;
+    const uint32_t slot = level * SlotCount + static_cast<uint32_t>((placementTick >> (SlotBits * level)) & (SlotCount - 1));
+
+    node.slot = slot;
+    node.previous = InvalidIndex;
+    node.next = slotHeads[slot];
+    if (node.next != InvalidIndex)
+    {
+        nodes[node.next].previous = index;
+    }
+    slotHeads[slot] = index;
+    levelCounts[level]++;
+}
+
+/**
+ * @brief Removes a node from its slot.
+ */
+void TimerWheel::Unlink(uint32_t index)
+{
+    Node& node = nodes[index];
+
+    if (node.previous != InvalidIndex)
+    {
+        nodes[node.previous].next = node.next;
+    }
+    else
+    {
+        slotHeads[node.slot] = node.next;
+    }
+
+    if (node.next != InvalidIndex)
+    {
+        nodes[node.next].previous = node.previous;
+    }
+
+    levelCounts[GetLevel(node.slot)]--;
+    node.slot = InvalidIndex;
+}
+
+/**
+ * @brief Returns an unlinked node to the free list and invalidates its ID.
+ */
+void TimerWheel::Release(uint32_t index)
+{
+    Node& node = nodes[index];
+    if (node.periodTicks == 0)
+    {
+        oneShotCount--;
+    }
+    timerCount--;
+
+    node.job = Job();
+    node.periodic.reset();
+    node.generation = node.generation == INT32_MAX ? 1 : node.generation + 1;
+    node.next = freeHead;
+    freeHead = index;
+}
+
+/**
+ * @brief Empties a slot and returns the first node of its former list (nodes keep their next links).
+ */
+uint32_t TimerWheel::Detach(uint32_t slot)
+{
+    const uint32_t head = slotHeads[slot];
+    slotHeads[slot] = InvalidIndex;
+
+    for (uint32_t index = head; index != InvalidIndex; index = nodes[index].next)
+    {
+        nodes[index].slot = InvalidIndex;
+        levelCounts[GetLevel(slot)]--;
+    }
+    return head;
+}
+
+/**
+ * @brief Re-places the timers of the current slot of a level into lower levels.
+ */
+void TimerWheel::Cascade(uint32_t level)
+{
+    const uint32_t slot = level * SlotCount + static_cast<uint32_t>((currentTick >> (SlotBits * level)) & (SlotCount - 1));
+
+    uint32_t index = Detach(slot);
+    while (index != InvalidIndex)
+    {
+        const uint32_t next = nodes[index].next;
+        Link(index);
+        index = next;
+    }
+}
+
+/**
+ * @brief Fires the timers of the current level-0 slot.
+ *
+ * One-shot timers are released. Periodic timers are re-armed one period after their deadline (or on the next
+ * tick if they fell behind), and emit a run only if their previous run is gone (ran, or was dropped unrun).
+ */
+void TimerWheel::Expire(std::vector<Job>& outDueJobs, std::vector<Job>& outPeriodicRuns)
+{
+    uint32_t index = Detach(static_cast<uint32_t>(currentTick & (SlotCount - 1)));
+    while (index != InvalidIndex)
+    {
+        Node& node = nodes[index];
+        const uint32_t next = node.next;
+
+        if (node.periodTicks == 0)
+        {
+            outDueJobs.push_back(std::move(node.job));
+            Release(index);
+        }
+        else
+        {
+            if (!node.periodic->running.exchange(true, std::memory_order_acquire))
+            {
+                Job run([guard = RunGuard(node.periodic)]()
+                {
+                    guard.periodic->job();
+                });
+                run.SetPriority(node.periodic->job.GetPriority());
+                outPeriodicRuns.push_back(std::move(run));
+            }
+
+            node.dueTick = std::max(node.dueTick + node.periodTicks, currentTick + 1);
+            Link(index);
+        }
+
+        index = next;
+    }
+}
+
+/**
+ * @brief Get the level of a global slot index.
+ */
+uint32_t TimerWheel::GetLevel(uint32_t slot)
+{
+    return slot / SlotCount;
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "Job.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <array>
+
+/**
+ * @brief Identifies a timer for cancellation (0 is never a valid ID)
+ *
+ * Packs the timer's slot in the wheel's node pool, a generation counter (so a stale ID
+ * never cancels a recycled slot) and a periodic flag.
+ */
+using TimerId = uint64_t;
+
+/**
+ * @brief Hierarchical timing wheel (not thread-safe, see TimerQueue)
+ *
+ * Four levels of 256 slots each. Level 0 has one slot per tick; each slot of level L
+ * covers 256^L ticks. A timer goes to the lowest level whose range covers its delay and
+ * moves down ("cascades") when the wheel reaches its slot, so it is re-placed at most
+ * once per level. Timers live in a pooled array and slots are intrusive doubly-linked
+ * lists of pool indexes, so Add and Cancel are O(1) and neither allocates once the pool
+ * has grown to the peak number of timers.
+ *
+ * Periodic timers are re-armed every period from their previous deadline (no drift). A run
+ * is skipped if the previous one is still executing, so runs of a timer never overlap.
+ */
+class TimerWheel
+{
+public:
+
+    //////// CONSTANTS ////////
+    static constexpr uint32_t SlotBits = 8;
+    static constexpr uint32_t SlotCount = 1u << SlotBits;
+    static constexpr uint32_t LevelCount = 4;
+
+    //////// CONSTRUCTOR ////////
+    explicit TimerWheel(int64_t startTick = 0);
+
+	//////// DELETED METHODS ////////
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+	//////// METHODS ////////
+    TimerId Add(int64_t dueTick, int64_t periodTicks, Job&& job);
+    bool Cancel(TimerId id);
+    void Advance(int64_t nowTick, std::vector<Job>& outDueJobs, std::vector<Job>& outPeriodicRuns);
+    size_t Clear();
+
+    //// Helpers
+    [[nodiscard]] int64_t GetNextExpiryTick() const;
+    [[nodiscard]] int64_t GetCurrentTick() const;
+    [[nodiscard]] size_t Size() const;
+
+	//////// STATIC METHODS ////////
+    [[nodiscard]] static bool IsPeriodic(TimerId id);
+
+private:
+
+    //////// CONSTANTS ////////
+    static constexpr uint32_t InvalidIndex = UINT32_MAX;
+    static constexpr uint64_t PeriodicFlag = uint64_t{ 1 } << 63;
+
+    //////// STRUCTS ////////
+    /**
+     * @brief Job of a periodic timer, shared with its queued runs
+     */
+    struct PeriodicJob
+    {
+        Job job;
+        std::atomic<bool> running{ false };
+    };
+
+    /**
+     * @brief Captured by a queued periodic run: clears running when the run is destroyed, whether it ran
+     *        or was dropped unrun (ClearAllJobs, Stop), so the timer is never left waiting for it
+     */
+    struct RunGuard
+    {
+        std::shared_ptr<PeriodicJob> periodic;
+
+        explicit RunGuard(std::shared_ptr<PeriodicJob> job) : periodic(std::move(job)) {}
+        RunGuard(RunGuard&&) noexcept = default;
+        RunGuard(const RunGuard&) = delete;
+        RunGuard& operator=(const RunGuard&) = delete;
+        RunGuard& operator=(RunGuard&&) = delete;
+        ~RunGuard()
+        {
+            if (periodic)
+            {
+                periodic->running.store(false, std::memory_order_release);
+            }
+        }
+    };
+
+    struct Node
+    {
+        int64_t dueTick = 0;
+        int64_t periodTicks = 0;
+        uint32_t previous = InvalidIndex;
+        uint32_t next = InvalidIndex;
+        uint32_t generation = 1;
+        uint32_t slot = InvalidIndex;
+        Job job;
+        std::shared_ptr<PeriodicJob> periodic;
+    };
+
+	//////// METHODS ////////
+    void Link(uint32_t index);
+    void Unlink(uint32_t index);
+    void Release(uint32_t index);
+    void Cascade(uint32_t level);
+    void Expire(std::vector<Job>& outDueJobs, std::vector<Job>& outPeriodicRuns);
+    uint32_t Detach(uint32_t slot);
+    static uint32_t GetLevel(uint32_t slot);
+
+    //////// FIELDS ////////
+    int64_t currentTick;
+    std::vector<Node> nodes;
+    uint32_t freeHead = InvalidIndex;
+    std::array<uint32_t, LevelCount * SlotCount> slotHeads;
+    std::array<size_t, LevelCount> levelCounts{};
+    size_t timerCount = 0;
+    size_t oneShotCount = 0;
+};
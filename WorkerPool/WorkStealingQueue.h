@@ -0,0 +1,83 @@
+#pragma once
+
+#include "RingBuffer.h"
+
+#include <cstddef>
+#include <mutex>
+
+/**
+ * @brief Per-worker double-ended job queue
+ *
+ * The owning worker pushes and pops at the back (LIFO, keeps hot data in cache),
+ * while other workers steal from the front (FIFO, takes the oldest work). Each
+ * queue has its own lock, so the only contention is between the owner and the
+ * occasional thief instead of between every producer and every worker.
+ */
+template <typename T>
+class WorkStealingQueue
+{
+public:
+
+    //////// METHODS ////////
+    //// Owner
+    void Push(T&& item)
+    {
+        std::scoped_lock lock(queueMutex);
+        items.PushBack(std::move(item));
+    }
+
+    void PushBatch(T* batch, size_t count)
+    {
+        std::scoped_lock lock(queueMutex);
+        for (size_t i = 0; i < count; i++)
+        {
+            items.PushBack(std::move(batch[i]));
+        }
+    }
+
+    bool TryPop(T& out)
+    {
+        std::scoped_lock lock(queueMutex);
+        if (items.Empty())
+        {
+            return false;
+        }
+
+        out = items.PopBack();
+        return true;
+    }
+
+    //// Thieves
+    bool TrySteal(T& out)
+    {
+        std::scoped_lock lock(queueMutex);
+        if (items.Empty())
+        {
+            return false;
+        }
+
+        out = items.PopFront();
+        return true;
+    }
+
+    //// Helpers
+    size_t Clear()
+    {
+        std::scoped_lock lock(queueMutex);
+        const size_t removed = items.Size();
+        items.Clear();
+        return removed;
+    }
+
+    [[nodiscard]] size_t Size() const
+    {
+        std::scoped_lock lock(queueMutex);
+        return items.Size();
+    }
+
+private:
+
+    //////// FIELDS ////////
+    mutable std::mutex queueMutex;
+    RingBuffer<T> items;
+};
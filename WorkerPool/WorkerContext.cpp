@@ -0,0 +1,50 @@
+#include "WorkerContext.h"
+
+namespace
+{
+    /**
+     * @brief Builds the engine of a worker: the seed sequence mixes the pool seed with the worker ID,
+     * so neighbouring workers get unrelated streams.
+     */
+    WorkerContext::RandomEngine MakeEngine(int workerID, uint64_t seed)
+    {
+        std::seed_seq sequence{ static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32), static_cast<uint32_t>(workerID) };
+        return WorkerContext::RandomEngine(sequence);
+    }
+}
+
+/**
+ * @brief Construct a new Worker Context:: Worker Context object
+ *
+ * @param workerID ID of the worker, -1 for a thread outside of any pool
+ * @param seed Seed of the pool (the worker ID is mixed in)
+ * @param scratchCapacity Size of the first block of the scratch arena
+ */
+WorkerContext::WorkerContext(int workerID, uint64_t seed, size_t scratchCapacity)
+    : workerID(workerID), random(MakeEngine(workerID, seed)), scratch(scratchCapacity)
+{
+}
+
+/**
+ * @brief Get the ID of the worker (-1 outside of a pool's workers).
+ */
+int WorkerContext::GetWorkerID() const
+{
+    return workerID;
+}
+
+/**
+ * @brief Get the worker's random engine, to use with the std distributions.
+ */
+WorkerContext::RandomEngine& WorkerContext::GetRandom()
+{
+    return random;
+}
+
+/**
+ * @brief Get the worker's scratch arena. The pool resets it after each job, so its memory only lives for the job.
+ */
+ScratchArena& WorkerContext::GetScratch()
+{
+    return scratch;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "ScratchArena.h"
+
+#include <cstdint>
+#include <random>
+
+/**
+ * @brief State owned by one worker and handed to the jobs it runs (see WorkerPool::GetContext)
+ *
+ * Only the thread the context belongs to touches it, so jobs use its random engine and scratch
+ * arena without any lock or atomic. Each worker's engine is seeded from the pool's randomSeed and
+ * the worker ID, so a worker always produces the same stream for a given seed (which worker runs
+ * which job still depends on scheduling).
+ */
+class alignas(64) WorkerContext
+{
+public:
+
+    //////// TYPES ////////
+    using RandomEngine = std::mt19937_64;
+
+    //////// CONSTRUCTOR ////////
+    WorkerContext(int workerID, uint64_t seed, size_t scratchCapacity);
+
+	//////// DELETED METHODS ////////
+    WorkerContext(const WorkerContext&) = delete;
+    WorkerContext& operator=(const WorkerContext&) = delete;
+
+	//////// METHODS ////////
+    [[nodiscard]] int GetWorkerID() const;
+    [[nodiscard]] RandomEngine& GetRandom();
+    [[nodiscard]] ScratchArena& GetScratch();
+
+private:
+
+    //////// FIELDS ////////
+    int workerID;
+    RandomEngine random;
+    ScratchArena scratch;
+};
@@ -3,23 +3,158 @@
 #include <algorithm>
 #include <iostream>
 #include <iomanip>
+#include <random>
 #include <string>
 
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <intrin.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace
+{
+    //// Identifies the pool and worker slot of the calling thread, so jobs submitted
+    //// from inside a job can go to the worker's own deque instead of the injection queue.
+    thread_local WorkerPool* currentPool = nullptr;
+    thread_local int currentWorkerID = -1;
+
+    //// Token of the job running on the calling thread (see WorkerPool::GetStopToken)
+    thread_local std::stop_token currentStopToken;
+
+    //// Context of the worker running on the calling thread (see WorkerPool::GetContext)
+    thread_local WorkerContext* currentContext = nullptr;
+
+    const char* const LaneNames[JobPriorityCount] = { "High", "Normal", "Low" };
+
+    //// Elastic mode: how often the supervisor samples the pool, and how many scaling events GetStats reports
+    constexpr std::chrono::milliseconds ScaleCheckInterval{ 5 };
+    constexpr size_t MaxScalingEvents = 64;
+
+    /**
+     * @brief Pins the calling thread to one CPU.
+     * @return false if the CPU is invalid or the platform does not support pinning
+     */
+    bool PinCurrentThread(int cpu)
+    {
+        if (cpu < 0)
+        {
+            return false;
+        }
+
+#if defined(_WIN32)
+        if (cpu >= static_cast<int>(sizeof(DWORD_PTR) * 8))
+        {
+            return false;
+        }
+        return SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR{ 1 } << cpu) != 0;
+#elif defined(__linux__)
+        if (cpu >= CPU_SETSIZE)
+        {
+            return false;
+        }
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(cpu, &cpuSet);
+        return pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet) == 0;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief Tells the CPU the caller is busy-waiting (frees pipeline resources for the sibling hyper-thread).
+     */
+    void CpuRelax()
+    {
+#if defined(_M_X64) || defined(_M_IX86)
+        _mm_pause();
+#elif defined(_M_ARM64)
+        __yield();
+#elif defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield");
+#else
+        std::this_thread::yield();
+#endif
+    }
+}
+
+/**
+ * @brief Construct a new Worker Pool:: Worker Pool object
+ * 
+ * Uses the default configuration (work-stealing scheduler).
+ */
+WorkerPool::WorkerPool() : WorkerPool(WorkerPoolConfig{})
+{
+}
+
 /**
  * @brief Construct a new Worker Pool:: Worker Pool object
  * 
- * This constructor initializes the worker pool by determining the maximum number of workers
- * based on the hardware concurrency. It then starts the specified number of worker threads
- * and begins the worker pool operation.
+ * This constructor initializes the worker pool with config.workerCount workers (by default, one less than
+ * the hardware concurrency). It creates the shared queue of each priority lane with the
+ * configured backend and, in work-stealing mode, one local deque per worker before any thread starts,
+ * then starts the worker threads and begins the worker pool operation. In elastic mode, deques, telemetry
+ * and thread slots are created up front for config.maxWorkerCount workers, so spawning a worker later never
+ * reallocates anything other threads read, and a supervisor thread is started.
  */
-WorkerPool::WorkerPool()
+WorkerPool::WorkerPool(const WorkerPoolConfig& config) : config(config)
 {
-    const uint32_t maxWorkerNumber = std::max(1u, std::thread::hardware_concurrency() - 1);
-    std::cout << "[WorkerPool] Starting with " << maxWorkerNumber << " workers\n";
+    coreWorkerCount = config.workerCount != 0 ? config.workerCount : std::max(2u, std::thread::hardware_concurrency()) - 1;
+    maxWorkerCount = std::max(coreWorkerCount, config.maxWorkerCount);
+    if (ShouldLog(LogLevel::Info))
+    {
+        Log({ .level = LogLevel::Info,
+              .message = config.schedulerMode == SchedulerMode::WorkStealing ? "Starting (work stealing)" : "Starting (shared queue)",
+              .labels = { "Workers", "Max workers" }, .values = { coreWorkerCount, maxWorkerCount } });
+    }
+
+    for (auto& jobQueue : jobQueues)
+    {
+        jobQueue = JobQueue::Create(config.queueBackend, config.queueCapacity);
+    }
+
+    if (config.schedulerMode == SchedulerMode::WorkStealing)
+    {
+        for (uint32_t i = 0; i < maxWorkerCount; i++)
+        {
+            localQueues.push_back(std::make_unique<WorkStealingQueue<Job>>());
+        }
+    }
+
+    startTime = NowNanoseconds();
+    for (uint32_t i = 0; i < maxWorkerCount; i++)
+    {
+        workerTelemetry.push_back(std::make_unique<WorkerTelemetry>());
+        workerContexts.push_back(std::make_unique<WorkerContext>(static_cast<int>(i), config.randomSeed, config.scratchArenaSize));
+    }
+
+    activeSlots = std::vector<std::atomic<bool>>(maxWorkerCount);
+    workersList.resize(maxWorkerCount);
+    for (uint32_t i = 0; i < coreWorkerCount; i++)
+    {
+        activeSlots[i] = true;
+        workersList[i] = std::jthread(&WorkerPool::Work, this, i);
+    }
+    activeWorkers = static_cast<int>(coreWorkerCount);
+    peakWorkers = static_cast<int>(coreWorkerCount);
 
-    for (uint32_t i = 0; i < maxWorkerNumber; i++)
+    if (maxWorkerCount > coreWorkerCount)
     {
-        workersList.emplace_back(std::jthread(&WorkerPool::Work, this, i));
+        supervisor = std::jthread([this](std::stop_token stopToken)
+        {
+            Supervise(stopToken);
+        });
     }
 
     Start();
@@ -51,7 +186,8 @@ void WorkerPool::Start()
  * 
  * This method stops the worker pool by setting the isRunning flag to false, clearing all jobs,
  * stopping all worker threads, and notifying all waiting threads. It ensures that the worker pool
- * is properly stopped and cleaned up.
+ * is properly stopped and cleaned up. Pending timers are dropped with the jobs the timer thread queued
+ * meanwhile: coroutines suspended on them are never resumed.
  */
 void WorkerPool::Stop()
 {
@@ -63,125 +199,1261 @@ void WorkerPool::Stop()
     isRunning = false;
     ClearAllJobs();
     StopAllWorkers();
-    std::cout << "[WorkerPool] Stopped\n";
+    StopTimers();
+    ClearAllJobs();
+
+    if (ShouldLog(LogLevel::Info))
+    {
+        Log({ .level = LogLevel::Info, .message = "Stopped" });
+    }
+    LogSink::Flush();
 }
 
+/**
+ * @brief Blocks until every job added so far has finished executing.
+ * 
+ * Waits on the in-flight counter (queued + running jobs) rather than on the queue size, so it cannot
+ * return while a popped job is still running. The last job to finish wakes the waiter immediately.
+ * Jobs added by a running job (including task continuations) are counted before the parent finishes,
+ * so a chain of jobs is waited for as a whole. Must not be called from a worker of this pool.
+ */
 void WorkerPool::WaitForCompletion() const
 {
-    while (GetPendingJobsCount() > 0)
+    std::unique_lock lock(completionMutex);
+    completionCondition.wait(lock, [this]
+    {
+        return inFlightJobs == 0;
+    });
+}
+
+/**
+ * @brief Blocks until every job has finished or the timeout expires.
+ * 
+ * @return true if all jobs finished, false if the timeout expired first
+ */
+bool WorkerPool::WaitForCompletion(std::chrono::milliseconds timeout) const
+{
+    std::unique_lock lock(completionMutex);
+    return completionCondition.wait_for(lock, timeout, [this]
+    {
+        return inFlightJobs == 0;
+    });
+}
+
+/**
+ * @brief Queues a job built by AddJob.
+ * 
+ * This method assigns a unique job ID to the job and queues it in its priority lane. In work-stealing
+ * mode a Normal job submitted from one of this pool's workers goes to that worker's local deque; every
+ * other submission goes through the shared queue of its lane, where a full bounded queue triggers the
+ * overflow policy (see HandleOverflow). It then wakes one sleeping worker.
+ * 
+ * @param canReject false for jobs that must not be dropped (task continuations): Reject then runs them inline
+ * @return ID of the job, or no value if it was rejected
+ */
+std::optional<uint64_t> WorkerPool::PushJob(Job&& job, bool canReject)
+{
+    const uint64_t jobId = nextJobId++;
+    const JobPriority priority = job.GetPriority();
+    job.SetId(jobId);
+    job.SetEnqueueTime(NowNanoseconds());
+    if (job.GetGroup())
+    {
+        job.GetGroup()->AddJobs(jobId, 1);
+    }
+    const int inFlight = ++inFlightJobs;
+    const int laneSize = ++queuedPerLane[static_cast<size_t>(priority)];
+    const int queueSize = ++queuedJobs;
+    RecordQueued(priority, laneSize, queueSize, inFlight);
+
+    if (ShouldLog(LogLevel::Debug))
+    {
+        Log({ .level = LogLevel::Debug, .message = "Added", .jobId = jobId, .labels = { "Queue size" }, .values = { queueSize } });
+    }
+
+    if (config.schedulerMode == SchedulerMode::WorkStealing && priority == JobPriority::Normal && currentPool == this)
+    {
+        localQueues[currentWorkerID]->Push(std::move(job));
+    }
+    else if (!jobQueues[static_cast<size_t>(priority)]->TryPush(job))
     {
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        const bool accepted = HandleOverflow(job, canReject);
+        WakeWorkers(1);
+        return accepted ? std::optional<uint64_t>(jobId) : std::nullopt;
     }
+
+    WakeWorkers(1);
+    return jobId;
 }
 
 /**
- * @brief Adds a new job to the worker pool.
+ * @brief Queues a batch of jobs built by AddJobs.
+ * 
+ * Job IDs and counters are reserved for the whole batch with one atomic operation each. The jobs then go,
+ * in one go, to the calling worker's deque or to the shared queue of their lane (a single lock acquisition
+ * with the mutex backend). In work-stealing mode, a large Normal batch submitted from outside the pool is
+ * instead cut into one contiguous slice per core worker deque (elastic workers may retire, so they only steal), so workers start on their own slice instead of
+ * all draining the injection queue; this is skipped with a bounded backend, so the bound still applies.
+ * Jobs that do not fit in a bounded queue go through the overflow policy one by one.
  * 
- * This method adds a new job to the jobs queue and assigns a unique job ID to it.
- * It then notifies one of the waiting worker threads to start processing the job.
+ * @return Number of jobs accepted
  */
-void WorkerPool::AddJob(std::function<void()> job)
+size_t WorkerPool::PushJobs(std::vector<Job>& jobs, JobPriority priority)
 {
-    int jobId = nextJobId++;
+    const int count = static_cast<int>(jobs.size());
+    if (count == 0)
+    {
+        return 0;
+    }
 
+    const uint64_t firstJobId = nextJobId.fetch_add(static_cast<uint64_t>(count));
+    const int64_t enqueueTime = NowNanoseconds();
+    for (int i = 0; i < count; i++)
     {
-        std::scoped_lock lock(jobMutex);
-        jobQueue.push({ job, jobId });
-        std::cout << "\n";
-        std::cout << "[WorkerPool] New Job Added | Queue size: " << std::setw(2) << jobQueue.size() << " | Task ID: " << std::setw(3) << jobId << "\n";
+        jobs[i].SetId(firstJobId + static_cast<uint64_t>(i));
+        jobs[i].SetPriority(priority);
+        jobs[i].SetEnqueueTime(enqueueTime);
+    }
+    if (jobs[0].GetGroup())
+    {
+        jobs[0].GetGroup()->AddJobs(firstJobId, count);
+    }
+
+    const int inFlight = (inFlightJobs += count);
+    const int laneSize = (queuedPerLane[static_cast<size_t>(priority)] += count);
+    const int queueSize = (queuedJobs += count);
+    RecordQueued(priority, laneSize, queueSize, inFlight);
+
+    if (ShouldLog(LogLevel::Debug))
+    {
+        Log({ .level = LogLevel::Debug, .message = "Batch added", .jobId = firstJobId,
+              .labels = { "Jobs", "Queue size" }, .values = { count, queueSize } });
+    }
+
+    JobQueue& laneQueue = *jobQueues[static_cast<size_t>(priority)];
+    const bool useLocalQueues = config.schedulerMode == SchedulerMode::WorkStealing && priority == JobPriority::Normal;
+    const size_t workerCount = coreWorkerCount;
+    size_t accepted = jobs.size();
+
+    if (useLocalQueues && currentPool == this)
+    {
+        localQueues[currentWorkerID]->PushBatch(jobs.data(), jobs.size());
+    }
+    else if (useLocalQueues && !laneQueue.IsBounded() && jobs.size() >= 2 * workerCount)
+    {
+        const size_t sliceSize = jobs.size() / workerCount;
+        for (size_t worker = 0; worker < workerCount; worker++)
+        {
+            const size_t begin = worker * sliceSize;
+            const size_t end = worker + 1 == workerCount ? jobs.size() : begin + sliceSize;
+            localQueues[worker]->PushBatch(jobs.data() + begin, end - begin);
+        }
+    }
+    else
+    {
+        const size_t pushed = laneQueue.TryPushBatch(jobs.data(), jobs.size());
+        if (pushed < jobs.size())
+        {
+            WakeWorkers(static_cast<int>(pushed));
+            for (size_t i = pushed; i < jobs.size(); i++)
+            {
+                if (!HandleOverflow(jobs[i], true))
+                {
+                    accepted--;
+                }
+            }
+        }
     }
-    ConditionalVariable.notify_one();
+
+    WakeWorkers(count);
+    return accepted;
 }
 
 /**
- * @brief Clears all jobs from the jobs queue.
+ * @brief Applies the overflow policy to a job that did not fit in its (bounded) lane queue.
+ * 
+ * The job's counters are already reserved. Block waits on spaceCondition, which consumers signal after each
+ * pop, and retries the push. A worker of this pool never blocks on it (all workers could end up waiting on
+ * each other), and jobs that cannot be rejected are never dropped: both cases run the job inline instead.
  * 
- * This method removes all pending jobs from the jobs queue by acquiring a lock on the jobMutex
- * and then popping each job from the queue until it is empty.
+ * @return false if the job was rejected
  */
-void WorkerPool::ClearAllJobs()
+bool WorkerPool::HandleOverflow(Job& job, bool canReject)
 {
+    const size_t lane = static_cast<size_t>(job.GetPriority());
+    OverflowPolicy policy = config.overflowPolicy;
+
+    if ((policy == OverflowPolicy::Block && currentPool == this) || (policy == OverflowPolicy::Reject && !canReject))
     {
-        std::scoped_lock lock(jobMutex);
-        while (!jobQueue.empty())
+        policy = OverflowPolicy::RunInline;
+    }
+
+    switch (policy)
+    {
+    case OverflowPolicy::Block:
+    {
+        std::unique_lock lock(spaceMutex);
+        waitingProducers++;
+        spaceCondition.wait(lock, [this, lane, &job]
+        {
+            return jobQueues[lane]->TryPush(job);
+        });
+        waitingProducers--;
+        return true;
+    }
+
+    case OverflowPolicy::Reject:
+        if (ShouldLog(LogLevel::Warning))
         {
-            jobQueue.pop();
+            Log({ .level = LogLevel::Warning, .message = "Rejected (queue full)", .jobId = job.GetId(), .workerID = currentWorkerID });
         }
+        rejectedJobs++;
+        queuedPerLane[lane]--;
+        queuedJobs--;
+        FinishJobs(1);
+        return false;
+
+    case OverflowPolicy::RunInline:
+    default:
+        RunInline(job);
+        return true;
     }
 }
 
 /**
- * @brief Stops all worker threads.
+ * @brief Runs a job on the calling thread instead of queueing it.
+ */
+void WorkerPool::RunInline(Job& job)
+{
+    ranInlineJobs++;
+    queuedPerLane[static_cast<size_t>(job.GetPriority())]--;
+    queuedJobs--;
+
+    if (ShouldLog(LogLevel::Debug))
+    {
+        Log({ .level = LogLevel::Debug, .message = "Ran inline (queue full)", .jobId = job.GetId(), .workerID = currentWorkerID });
+    }
+    std::stop_source jobStopSource;
+    ScratchArena& scratch = GetContext().GetScratch();
+    const ScratchArena::Marker scratchMarker = scratch.GetMarker();
+    RunJob(job, jobStopSource, currentPool == this ? currentStopToken : std::stop_token());
+    scratch.Rewind(scratchMarker);
+    job = Job();
+    FinishJobs(1);
+}
+
+/**
+ * @brief Runs a popped job on the calling thread, unless its group cancelled it.
  * 
- * This method requests all worker threads to stop by calling request_stop() on each worker.
- * It then notifies all waiting threads to ensure they can exit their wait state.
+ * Ungrouped jobs just run, with the worker's stop token as current token. A grouped job is first checked
+ * against its group; while it runs, its token comes from jobStopSource, which the group's cancellation, a
+ * CancelJob on the job and the worker's own stop request all stop. The stop source cannot be reset, so a
+ * new one is only created after a run that was stopped.
+ * 
+ * @return false if the job was skipped because it was cancelled
  */
-void WorkerPool::StopAllWorkers()
+bool WorkerPool::RunJob(Job& job, std::stop_source& jobStopSource, const std::stop_token& workerStopToken)
 {
-    for (auto& worker : workersList)
+    JobGroupState* group = job.GetGroup().get();
+    if (group == nullptr)
     {
-        worker.request_stop();
+        job();
+        return true;
     }
-    ConditionalVariable.notify_all();
+
+    if (jobStopSource.stop_requested())
+    {
+        jobStopSource = std::stop_source();
+    }
+
+    if (!group->BeginJob(job.GetId(), &jobStopSource))
+    {
+        cancelledJobs++;
+        if (ShouldLog(LogLevel::Debug))
+        {
+            Log({ .level = LogLevel::Debug, .message = "Cancelled", .jobId = job.GetId(), .workerID = currentWorkerID,
+                  .labels = { "Group" }, .values = { group->GetId() } });
+        }
+        return false;
+    }
+
+    auto forwardStop = [&jobStopSource]() { jobStopSource.request_stop(); };
+    std::stop_callback groupStop(group->GetStopToken(), forwardStop);
+    std::stop_callback workerStop(workerStopToken, forwardStop);
+
+    const std::stop_token previousStopToken = std::exchange(currentStopToken, jobStopSource.get_token());
+    job();
+    currentStopToken = previousStopToken;
+    return true;
 }
 
 /**
- * @brief Checks if the worker pool is currently running.
+ * @brief Wakes the producers blocked on a full bounded queue, if any.
  * 
- * This method returns the status of the worker pool, indicating whether it is currently active and processing jobs.
+ * Same handshake as WakeWorkers: producers register under spaceMutex before retrying their push.
  */
-bool WorkerPool::IsRunning() const
+void WorkerPool::NotifyProducers()
 {
-    return isRunning;
+    if (waitingProducers > 0)
+    {
+        {
+            std::scoped_lock lock(spaceMutex);
+        }
+        spaceCondition.notify_all();
+    }
 }
 
 /**
- * @brief Get the count of pending jobs in the queue.
+ * @brief Queues a job once a deadline has passed (steady clock, nanoseconds since its epoch).
  * 
- * This method returns the number of jobs that are currently pending in the jobs queue.
- * It acquires a lock on the jobMutex to ensure thread safety while accessing the queue.
+ * The job counts as in flight from now on, so WaitForCompletion also waits for pending timers. When it is
+ * due, the timer thread queues it through PushJob (never rejected).
  */
-int WorkerPool::GetPendingJobsCount() const
+TimerId WorkerPool::AddTimer(int64_t dueTime, Job&& job)
 {
-    std::scoped_lock lock(jobMutex);
-    return jobQueue.size();
+    UpdateHighWaterMark(inFlightHighWaterMark, ++inFlightJobs);
+    return GetTimers().Add(dueTime, std::move(job));
 }
 
 /**
- * @brief Worker thread function.
+ * @brief Registers a periodic job; each due run is queued through PushJob (never rejected).
+ */
+TimerId WorkerPool::AddPeriodicTimer(std::chrono::nanoseconds period, Job&& job)
+{
+    return GetTimers().AddPeriodic(NowNanoseconds() + period.count(), period.count(), std::move(job));
+}
+
+/**
+ * @brief Cancels a delayed or periodic job in O(1).
+ * 
+ * A cancelled delayed job is no longer counted by WaitForCompletion. A run of a periodic job that is already
+ * queued or running still completes.
  * 
- * This method is executed by each worker thread in the pool. It continuously waits for jobs to be added to the queue.
- * When a job is available, it processes the job and then waits for the next job. The method exits when a stop request is received.
+ * @return false if the job already ran (delayed job), was already cancelled or the ID is unknown
  */
-void WorkerPool::Work(std::stop_token stopToken, WorkerPool* self, int workerID)
+bool WorkerPool::CancelTimer(TimerId id)
 {
-    while (!stopToken.stop_requested())
+    if (!hasTimers || !timers->Cancel(id))
+    {
+        return false;
+    }
+
+    if (!TimerWheel::IsPeriodic(id))
     {
-        std::unique_lock<std::mutex> lock(self->jobMutex);
+        FinishJobs(1);
+    }
+    return true;
+}
 
-        self->ConditionalVariable.wait(lock, [self]
+/**
+ * @brief Get the timer queue, starting the timer thread on first use.
+ * 
+ * Due one-shot jobs release the in-flight slot reserved by AddTimer once they are queued (and counted again).
+ */
+TimerQueue& WorkerPool::GetTimers()
+{
+    std::call_once(timersCreation, [this]
+    {
+        timers = std::make_unique<TimerQueue>([this](Job& dueJob, bool periodic)
         {
-            return !self->jobQueue.empty();
+            PushJob(std::move(dueJob), false);
+            if (!periodic)
+            {
+                FinishJobs(1);
+            }
         });
+        hasTimers = true;
+    });
+    return *timers;
+}
+
+/**
+ * @brief Stops the timer thread, if it was started, and drops the pending timers.
+ */
+void WorkerPool::StopTimers()
+{
+    if (hasTimers)
+    {
+        FinishJobs(static_cast<int>(timers->Stop()));
+    }
+}
+
+/**
+ * @brief Returns an awaitable that moves the awaiting coroutine onto a worker of this pool.
+ * 
+ * co_await pool.Schedule() queues the rest of the coroutine as a job of the given lane.
+ */
+WorkerPool::ScheduleAwaiter WorkerPool::Schedule(JobPriority priority)
+{
+    return ScheduleAwaiter(this, priority);
+}
+
+/**
+ * @brief Returns an awaitable that suspends the awaiting coroutine for a duration without holding a worker.
+ * 
+ * co_await pool.Delay(std::chrono::milliseconds(500)) registers a timer; when it fires, the rest of the
+ * coroutine is queued as a Normal job.
+ */
+WorkerPool::DelayAwaiter WorkerPool::Delay(std::chrono::nanoseconds duration)
+{
+    return DelayAwaiter(this, duration);
+}
+
+/**
+ * @brief Queues the resumption of the awaiting coroutine (never rejected by a full bounded queue).
+ */
+void WorkerPool::ScheduleAwaiter::await_suspend(std::coroutine_handle<> handle) const
+{
+    Job resume([handle]() { handle.resume(); });
+    resume.SetPriority(priority);
+    pool->PushJob(std::move(resume), false);
+}
+
+/**
+ * @brief Registers a timer that queues the resumption of the awaiting coroutine.
+ */
+void WorkerPool::DelayAwaiter::await_suspend(std::coroutine_handle<> handle) const
+{
+    pool->AddTimer(NowNanoseconds() + duration.count(), Job([handle]() { handle.resume(); }));
+}
+
+/**
+ * @brief Clears all jobs from the jobs queue.
+ * 
+ * This method removes all pending jobs from the shared lane queues and from every worker's local deque
+ * (which only hold Normal jobs), and updates the pending job counters accordingly. Cleared jobs of a group
+ * leave it, so WaitForGroup does not wait for them. Use CancelGroup to drop a single batch instead.
+ */
+void WorkerPool::ClearAllJobs()
+{
+    int removed = 0;
+
+    for (size_t lane = 0; lane < JobPriorityCount; lane++)
+    {
+        const int laneRemoved = static_cast<int>(jobQueues[lane]->Clear());
+        queuedPerLane[lane] -= laneRemoved;
+        removed += laneRemoved;
+    }
+
+    for (auto& localQueue : localQueues)
+    {
+        const int localRemoved = static_cast<int>(localQueue->Clear());
+        queuedPerLane[static_cast<size_t>(JobPriority::Normal)] -= localRemoved;
+        removed += localRemoved;
+    }
+
+    queuedJobs -= removed;
+    NotifyProducers();
+    FinishJobs(removed);
+}
+
+/**
+ * @brief Get the worker-local context of the calling thread.
+ * 
+ * In a job run by a worker, this is the worker's own context: its ID, its random engine (seeded from
+ * config.randomSeed and the ID) and its scratch arena, which is reset after every job. Nothing in it is shared
+ * with other workers, so no lock is needed. Any other thread (e.g. a producer running a job inline) gets a
+ * context of its own, with ID -1 and a randomly seeded engine.
+ */
+WorkerContext& WorkerPool::GetContext()
+{
+    if (currentContext == nullptr)
+    {
+        thread_local WorkerContext threadContext(-1, (static_cast<uint64_t>(std::random_device{}()) << 32) | std::random_device{}(),
+                                                 ScratchArena::DefaultCapacity);
+        return threadContext;
+    }
+    return *currentContext;
+}
+
+/**
+ * @brief Creates an empty job group.
+ * 
+ * Jobs added with AddJobToGroup/AddJobsToGroup can then be waited for and cancelled as a whole, without
+ * touching the other jobs of the pool.
+ */
+JobGroup WorkerPool::CreateGroup()
+{
+    auto state = std::make_shared<JobGroupState>(nextGroupId++);
+
+    std::scoped_lock lock(groupsMutex);
+    std::erase_if(groups, [](const std::weak_ptr<JobGroupState>& group) { return group.expired(); });
+    groups.push_back(state);
+    return JobGroup(std::move(state));
+}
 
-        if (self->jobQueue.empty()) continue;
+/**
+ * @brief Blocks until every job of a group has finished, was skipped or was dropped.
+ * 
+ * Jobs a group job adds to the same group are registered before it finishes, so a fan-out is waited for as a
+ * whole. Must not be called from a worker of this pool.
+ */
+void WorkerPool::WaitForGroup(const JobGroup& group) const
+{
+    if (group.state)
+    {
+        group.state->Wait();
+    }
+}
 
-        auto [currentJob, jobId] = self->jobQueue.front();
-        self->jobQueue.pop();
+/**
+ * @brief Blocks until every job of a group is done or the timeout expires.
+ * 
+ * @return true if the group is done, false if the timeout expired first
+ */
+bool WorkerPool::WaitForGroup(const JobGroup& group, std::chrono::milliseconds timeout) const
+{
+    return !group.state || group.state->Wait(timeout);
+}
 
-        self->LogWorkerMessage(jobId, workerID, "Attributed | Queue size: " + std::to_string(self->jobQueue.size()), self->silent);
-        lock.unlock();
+/**
+ * @brief Cancels every job of a group.
+ * 
+ * Queued jobs stay in their queue but are skipped (not run) when a worker pops them, so a cancelled fan-out
+ * stops using CPU time right away; running jobs see a stop request on their token and are expected to return
+ * early. Other jobs are not affected. Jobs added to the group afterwards are skipped too.
+ * 
+ * @return Number of jobs of the group that were queued or running
+ */
+size_t WorkerPool::CancelGroup(const JobGroup& group)
+{
+    if (!group.state)
+    {
+        return 0;
+    }
 
-        self->LogWorkerMessage(jobId, workerID, "Started", self->silent);
-        currentJob();
-        self->LogWorkerMessage(jobId, workerID, "Completed", self->silent);
+    const size_t pending = group.state->Cancel();
+    if (ShouldLog(LogLevel::Info))
+    {
+        Log({ .level = LogLevel::Info, .message = "Group cancelled", .labels = { "Group", "Pending jobs" },
+              .values = { group.state->GetId(), static_cast<int64_t>(pending) } });
     }
+    return pending;
 }
 
-void WorkerPool::LogWorkerMessage(int jobId, int workerID, const std::string& message, bool silent) const
+/**
+ * @brief Cancels one job added to a group.
+ * 
+ * A queued job is skipped when popped; a running job sees a stop request on its token. Ungrouped jobs are not
+ * tracked individually and cannot be cancelled.
+ * 
+ * @return false if the job is not a queued or running job of a live group
+ */
+bool WorkerPool::CancelJob(uint64_t jobId)
 {
-    if (!silent)
+    std::vector<std::shared_ptr<JobGroupState>> liveGroups;
     {
-        std::cout << "[WorkerPool > " << std::setw(3) << jobId << "] " << message << " (Worker" << workerID << ")\n";
+        std::scoped_lock lock(groupsMutex);
+        for (const auto& group : groups)
+        {
+            if (auto state = group.lock())
+            {
+                liveGroups.push_back(std::move(state));
+            }
+        }
     }
+
+    for (const auto& group : liveGroups)
+    {
+        if (group->CancelJob(jobId))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Get the stop token of the job running on the calling thread.
+ * 
+ * Long jobs poll it (stop_requested) to return early: for a grouped job it is stopped by CancelGroup, CancelJob
+ * or Stop, for other jobs by Stop only. Outside of a job it is a token that is never stopped.
+ */
+std::stop_token WorkerPool::GetStopToken()
+{
+    return currentStopToken;
+}
+
+/**
+ * @brief Stops all worker threads.
+ * 
+ * This method requests all worker threads to stop by calling request_stop() on each worker.
+ * It then notifies all waiting threads to ensure they can exit their wait state, and joins them
+ * so no worker still touches the pool (condition variables, counters) while it is being destroyed.
+ * A worker stopping its own pool is detached from the join, as it cannot wait for itself. The elastic
+ * supervisor is stopped first, so no worker is spawned meanwhile; retired workers are simply joined.
+ */
+void WorkerPool::StopAllWorkers()
+{
+    supervisor.request_stop();
+    if (supervisor.joinable())
+    {
+        supervisor.join();
+    }
+
+    for (auto& worker : workersList)
+    {
+        worker.request_stop();
+    }
+    ConditionalVariable.notify_all();
+
+    for (auto& worker : workersList)
+    {
+        if (worker.joinable() && worker.get_id() != std::this_thread::get_id())
+        {
+            worker.join();
+        }
+    }
+}
+
+/**
+ * @brief Checks if the worker pool is currently running.
+ * 
+ * This method returns the status of the worker pool, indicating whether it is currently active and processing jobs.
+ */
+bool WorkerPool::IsRunning() const
+{
+    return isRunning;
+}
+
+/**
+ * @brief Get the count of pending jobs in the queue.
+ * 
+ * This method returns the number of jobs that are currently pending, summed over the shared queue
+ * and every worker's local deque. The counter is maintained atomically, so no lock is taken.
+ */
+int WorkerPool::GetPendingJobsCount() const
+{
+    return queuedJobs;
+}
+
+/**
+ * @brief Get the count of jobs that are queued or currently executing.
+ */
+int WorkerPool::GetInFlightJobsCount() const
+{
+    return inFlightJobs;
+}
+
+/**
+ * @brief Get the number of worker threads currently running (varies between the bounds in elastic mode).
+ */
+int WorkerPool::GetWorkerCount() const
+{
+    return activeWorkers;
+}
+
+/**
+ * @brief Get the scheduler mode the pool was created with.
+ */
+SchedulerMode WorkerPool::GetSchedulerMode() const
+{
+    return config.schedulerMode;
+}
+
+/**
+ * @brief Get the configuration the pool was created with.
+ */
+const WorkerPoolConfig& WorkerPool::GetConfig() const
+{
+    return config;
+}
+
+/**
+ * @brief Get the queue-wait latency percentiles of a priority lane.
+ * 
+ * Queue wait is the time between submission and the moment a worker starts the job. Each worker records
+ * into its own histograms; this method merges them, so it can be called at any time without stalling workers.
+ */
+LatencySummary WorkerPool::GetLaneLatency(JobPriority priority) const
+{
+    LatencyHistogram merged;
+    for (const auto& telemetry : workerTelemetry)
+    {
+        merged.Merge(telemetry->GetQueueWait(priority));
+    }
+    return merged.Summarize();
+}
+
+/**
+ * @brief Takes a snapshot of the pool's telemetry.
+ * 
+ * Per-lane queue-wait and execution histograms are merged from every worker, so this can be polled at any time
+ * (e.g. from a monitoring thread) without stalling the workers. Use WorkerPoolStats::ToJson to dump it.
+ */
+WorkerPoolStats WorkerPool::GetStats() const
+{
+    const int64_t now = NowNanoseconds();
+    WorkerPoolStats stats;
+    stats.uptimeNanoseconds = static_cast<uint64_t>(now - startTime);
+    stats.jobsSubmitted = nextJobId.load();
+    stats.jobsRejected = rejectedJobs;
+    stats.jobsRanInline = ranInlineJobs;
+    stats.jobsCancelled = cancelledJobs;
+    stats.jobStorageHeapAllocations = JobStorage::GetHeapAllocationCount();
+    stats.queuedJobs = queuedJobs;
+    stats.queuedHighWaterMark = queuedHighWaterMark;
+    stats.inFlightJobs = inFlightJobs;
+    stats.inFlightHighWaterMark = inFlightHighWaterMark;
+
+    for (size_t lane = 0; lane < JobPriorityCount; lane++)
+    {
+        const JobPriority priority = static_cast<JobPriority>(lane);
+        LatencyHistogram queueWait;
+        LatencyHistogram execution;
+        for (const auto& telemetry : workerTelemetry)
+        {
+            queueWait.Merge(telemetry->GetQueueWait(priority));
+            execution.Merge(telemetry->GetExecution(priority));
+        }
+
+        LaneStats& laneStats = stats.lanes[lane];
+        laneStats.queued = queuedPerLane[lane];
+        laneStats.queuedHighWaterMark = queuedHighWaterMarks[lane];
+        laneStats.running = runningPerLane[lane];
+        laneStats.queueWait = queueWait.Summarize();
+        laneStats.execution = execution.Summarize();
+    }
+
+    const int workerSlots = peakWorkers;
+    for (int worker = 0; worker < workerSlots; worker++)
+    {
+        WorkerStats& workerStats = stats.workers.emplace_back(workerTelemetry[worker]->GetStats(worker, now));
+        workerStats.active = activeSlots[worker];
+    }
+
+    stats.scaling.minWorkers = coreWorkerCount;
+    stats.scaling.maxWorkers = maxWorkerCount;
+    stats.scaling.activeWorkers = activeWorkers;
+    stats.scaling.peakWorkers = workerSlots;
+    stats.scaling.workersSpawned = spawnedWorkers;
+    stats.scaling.workersRetired = retiredWorkers;
+    {
+        std::scoped_lock lock(scalingMutex);
+        stats.scaling.recentEvents.assign(scalingEvents.begin(), scalingEvents.end());
+    }
+
+    return stats;
+}
+
+/**
+ * @brief Prints the queue-wait latency percentiles of every priority lane.
+ */
+void WorkerPool::PrintLaneLatencyReport() const
+{
+    LogSink::Flush();
+    std::cout << "[WorkerPool] Queue wait per lane (ms):\n";
+    for (size_t lane = 0; lane < JobPriorityCount; lane++)
+    {
+        const LatencySummary summary = GetLaneLatency(static_cast<JobPriority>(lane));
+        std::cout << "- " << std::left << std::setw(6) << LaneNames[lane] << std::right
+                  << " | jobs: " << std::setw(6) << summary.count << std::fixed << std::setprecision(3)
+                  << " | p50: " << std::setw(9) << summary.p50 / 1e6
+                  << " | p99: " << std::setw(9) << summary.p99 / 1e6
+                  << " | max: " << std::setw(9) << summary.max / 1e6 << "\n";
+        std::cout << std::defaultfloat;
+    }
+}
+
+/**
+ * @brief Worker thread function.
+ * 
+ * This method is executed by each worker thread in the pool. It repeatedly looks for a job (see TryGetJob)
+ * and runs it. When no job can be found, the worker parks on the condition variable until a job is queued.
+ * The method exits when a stop request is received, or when an elastic worker stayed parked for retireDelay.
+ */
+void WorkerPool::Work(std::stop_token stopToken, WorkerPool* self, int workerID)
+{
+    currentPool = self;
+    currentWorkerID = workerID;
+    currentStopToken = stopToken;
+    std::stop_source jobStopSource;
+    WorkerTelemetry& telemetry = *self->workerTelemetry[workerID];
+    WorkerContext& context = *self->workerContexts[workerID];
+    currentContext = &context;
+
+    const std::vector<int>& affinity = self->config.workerAffinity;
+    if (!affinity.empty())
+    {
+        const int cpu = affinity[workerID % affinity.size()];
+        if (!PinCurrentThread(cpu) && self->ShouldLog(LogLevel::Warning))
+        {
+            self->Log({ .level = LogLevel::Warning, .message = "Could not pin worker", .workerID = workerID, .labels = { "CPU" }, .values = { cpu } });
+        }
+    }
+
+    while (!stopToken.stop_requested())
+    {
+        Job currentJob;
+        bool stolen = false;
+
+        if (!self->TryGetJob(workerID, currentJob, stolen))
+        {
+            if (self->config.idlePolicy != IdlePolicy::Park && self->SpinForJob(stopToken))
+            {
+                continue;
+            }
+
+            telemetry.BeginPark(NowNanoseconds());
+            bool retire = false;
+            {
+                std::unique_lock<std::mutex> lock(self->jobMutex);
+                self->sleepingWorkers++;
+                auto hasRunnableJob = [self]
+                {
+                    return self->HasRunnableJob();
+                };
+                if (workerID < static_cast<int>(self->coreWorkerCount))
+                {
+                    self->ConditionalVariable.wait(lock, stopToken, hasRunnableJob);
+                }
+                else
+                {
+                    retire = !self->ConditionalVariable.wait_for(lock, stopToken, self->config.retireDelay, hasRunnableJob)
+                             && !stopToken.stop_requested();
+                }
+                self->sleepingWorkers--;
+            }
+            telemetry.EndPark(NowNanoseconds());
+
+            if (retire)
+            {
+                self->RetireWorker(workerID);
+                break;
+            }
+            continue;
+        }
+
+        const uint64_t jobId = currentJob.GetId();
+        const JobPriority priority = currentJob.GetPriority();
+        const int64_t jobStartTime = NowNanoseconds();
+
+        const bool logJob = self->ShouldLog(LogLevel::Debug);
+        if (logJob)
+        {
+            self->Log({ .level = LogLevel::Debug, .message = stolen ? "Stolen" : "Attributed", .jobId = jobId, .workerID = workerID,
+                        .labels = { "Queue size" }, .values = { self->queuedJobs.load() } });
+        }
+
+        telemetry.BeginJob(jobStartTime);
+        const bool ran = self->RunJob(currentJob, jobStopSource, stopToken);
+        telemetry.EndJob();
+        context.GetScratch().Reset();
+        if (ran)
+        {
+            telemetry.RecordJob(priority, static_cast<uint64_t>(jobStartTime - currentJob.GetEnqueueTime()),
+                                static_cast<uint64_t>(NowNanoseconds() - jobStartTime), stolen);
+
+            if (logJob)
+            {
+                self->Log({ .level = LogLevel::Debug, .message = "Completed", .jobId = jobId, .workerID = workerID });
+            }
+        }
+        currentJob = Job();
+        self->ReleaseLane(priority);
+        self->FinishJobs(1);
+    }
+
+    currentPool = nullptr;
+    currentWorkerID = -1;
+    currentStopToken = std::stop_token();
+    currentContext = nullptr;
+}
+
+/**
+ * @brief Elastic mode supervisor thread function.
+ * 
+ * Samples the pool every ScaleCheckInterval. The pool is backed up when jobs are queued, no worker is parked
+ * (a parked worker would take them) and at least one worker has been on its current job for blockedThreshold.
+ * When that holds on every sample for scaleUpDelay, one worker is spawned and the window starts over, so the
+ * pool grows by at most one worker per scaleUpDelay. Retirement is decided by the idle workers themselves.
+ */
+void WorkerPool::Supervise(std::stop_token stopToken)
+{
+    const int64_t scaleUpDelay = std::chrono::duration_cast<std::chrono::nanoseconds>(config.scaleUpDelay).count();
+    int64_t backedUpSince = 0;
+
+    std::unique_lock lock(supervisorMutex);
+    while (!stopToken.stop_requested())
+    {
+        supervisorCondition.wait_for(lock, stopToken, ScaleCheckInterval, [] { return false; });
+        if (stopToken.stop_requested())
+        {
+            break;
+        }
+
+        const int64_t now = NowNanoseconds();
+        const int queued = queuedJobs;
+        const int blocked = queued > 0 && sleepingWorkers == 0 ? CountBlockedWorkers(now) : 0;
+        if (blocked == 0 || activeWorkers >= static_cast<int>(maxWorkerCount))
+        {
+            backedUpSince = 0;
+            continue;
+        }
+
+        if (backedUpSince == 0)
+        {
+            backedUpSince = now;
+        }
+        else if (now - backedUpSince >= scaleUpDelay)
+        {
+            SpawnWorker(queued, blocked);
+            backedUpSince = 0;
+        }
+    }
+}
+
+/**
+ * @brief Starts a worker in the first free elastic slot (called by the supervisor only).
+ * 
+ * The thread that last used the slot has retired: it is joined before its slot is reused.
+ */
+void WorkerPool::SpawnWorker(int queued, int blocked)
+{
+    for (uint32_t slot = coreWorkerCount; slot < maxWorkerCount; slot++)
+    {
+        if (activeSlots[slot])
+        {
+            continue;
+        }
+
+        if (workersList[slot].joinable())
+        {
+            workersList[slot].join();
+        }
+
+        activeSlots[slot] = true;
+        const int workerCount = ++activeWorkers;
+        UpdateHighWaterMark(peakWorkers, workerCount);
+        spawnedWorkers++;
+        workersList[slot] = std::jthread(&WorkerPool::Work, this, static_cast<int>(slot));
+        RecordScaling(ScalingAction::Spawned, static_cast<int>(slot), workerCount, queued, blocked);
+        return;
+    }
+}
+
+/**
+ * @brief Called by an elastic worker that stayed idle for retireDelay, right before its thread exits.
+ * 
+ * Its local deque is empty (it found no job before parking and only its owner pushes to it). The slot is
+ * released last, so the supervisor only reuses it once the thread is done with the pool.
+ */
+void WorkerPool::RetireWorker(int workerID)
+{
+    const int workerCount = --activeWorkers;
+    retiredWorkers++;
+    RecordScaling(ScalingAction::Retired, workerID, workerCount, queuedJobs, 0);
+    activeSlots[workerID] = false;
+}
+
+/**
+ * @brief Counts the workers that have been running the same job for at least blockedThreshold.
+ */
+int WorkerPool::CountBlockedWorkers(int64_t now) const
+{
+    const int64_t threshold = std::chrono::duration_cast<std::chrono::nanoseconds>(config.blockedThreshold).count();
+    int blocked = 0;
+    for (uint32_t slot = 0; slot < maxWorkerCount; slot++)
+    {
+        const int64_t jobStart = workerTelemetry[slot]->GetJobStartTime();
+        if (activeSlots[slot] && jobStart != 0 && now - jobStart >= threshold)
+        {
+            blocked++;
+        }
+    }
+    return blocked;
+}
+
+/**
+ * @brief Keeps a scaling decision for GetStats (the oldest one is dropped past MaxScalingEvents) and logs it.
+ */
+void WorkerPool::RecordScaling(ScalingAction action, int workerID, int workerCount, int queued, int blocked)
+{
+    {
+        std::scoped_lock lock(scalingMutex);
+        scalingEvents.push_back({ static_cast<uint64_t>(NowNanoseconds() - startTime), action, workerID, workerCount, queued, blocked });
+        if (scalingEvents.size() > MaxScalingEvents)
+        {
+            scalingEvents.pop_front();
+        }
+    }
+
+    if (ShouldLog(LogLevel::Info))
+    {
+        Log({ .level = LogLevel::Info, .message = action == ScalingAction::Spawned ? "Worker spawned" : "Worker retired", .workerID = workerID,
+              .labels = { "Workers", action == ScalingAction::Spawned ? "Blocked" : "Queued" },
+              .values = { workerCount, action == ScalingAction::Spawned ? blocked : queued } });
+    }
+}
+
+/**
+ * @brief Looks for the next job a worker should run.
+ * 
+ * Lanes are served in priority order: High first, then Normal, then Low, each only while the lane is under
+ * its worker limit. For the Normal lane in work-stealing mode, the worker first pops its own deque (newest
+ * first), then the injection queue, and finally tries to steal the oldest job of the other workers, starting
+ * with its neighbour so thieves spread out. On success, the worker holds a running slot of the job's lane.
+ */
+bool WorkerPool::TryGetJob(int workerID, Job& outJob, bool& outStolen)
+{
+    outStolen = false;
+
+    if (TryPopLane(JobPriority::High, outJob))
+    {
+        return true;
+    }
+
+    if (config.schedulerMode == SchedulerMode::WorkStealing && queuedPerLane[static_cast<size_t>(JobPriority::Normal)] > 0
+        && TryAcquireLane(JobPriority::Normal))
+    {
+        if (localQueues[workerID]->TryPop(outJob))
+        {
+            queuedPerLane[static_cast<size_t>(JobPriority::Normal)]--;
+            queuedJobs--;
+            return true;
+        }
+        ReleaseLane(JobPriority::Normal);
+    }
+
+    if (TryPopLane(JobPriority::Normal, outJob))
+    {
+        return true;
+    }
+
+    if (config.schedulerMode == SchedulerMode::WorkStealing && queuedPerLane[static_cast<size_t>(JobPriority::Normal)] > 0
+        && TryAcquireLane(JobPriority::Normal))
+    {
+        const size_t workerCount = localQueues.size();
+        for (size_t offset = 1; offset < workerCount; offset++)
+        {
+            const size_t victim = (workerID + offset) % workerCount;
+            if (localQueues[victim]->TrySteal(outJob))
+            {
+                queuedPerLane[static_cast<size_t>(JobPriority::Normal)]--;
+                queuedJobs--;
+                outStolen = true;
+                return true;
+            }
+        }
+        ReleaseLane(JobPriority::Normal);
+    }
+
+    return TryPopLane(JobPriority::Low, outJob);
+}
+
+/**
+ * @brief Pops the oldest job of a lane's shared queue, if the lane has one and is under its worker limit.
+ * 
+ * The lane counter is checked first so empty lanes cost nothing. A successful pop frees room in a bounded
+ * queue, so producers blocked on it are signalled.
+ */
+bool WorkerPool::TryPopLane(JobPriority priority, Job& outJob)
+{
+    const size_t lane = static_cast<size_t>(priority);
+    if (queuedPerLane[lane] == 0 || !TryAcquireLane(priority))
+    {
+        return false;
+    }
+
+    if (jobQueues[lane]->TryPop(outJob))
+    {
+        queuedPerLane[lane]--;
+        queuedJobs--;
+        NotifyProducers();
+        return true;
+    }
+
+    ReleaseLane(priority);
+    return false;
+}
+
+/**
+ * @brief Reserves a running slot in a lane, failing if the lane is at its worker limit.
+ */
+bool WorkerPool::TryAcquireLane(JobPriority priority)
+{
+    const size_t lane = static_cast<size_t>(priority);
+    const uint32_t limit = config.laneWorkerLimits[lane];
+
+    if (++runningPerLane[lane] > static_cast<int>(limit) && limit != 0)
+    {
+        runningPerLane[lane]--;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Frees a running slot of a lane.
+ * 
+ * If the lane is limited and still has queued jobs, a parked worker may have skipped them because the lane
+ * was full, so one worker is woken to pick them up.
+ */
+void WorkerPool::ReleaseLane(JobPriority priority)
+{
+    const size_t lane = static_cast<size_t>(priority);
+    runningPerLane[lane]--;
+
+    if (config.laneWorkerLimits[lane] != 0 && queuedPerLane[lane] > 0)
+    {
+        WakeWorkers(1);
+    }
+}
+
+/**
+ * @brief Checks whether a parked worker would find a job it is allowed to run.
+ * 
+ * Jobs of a lane at its worker limit do not count, so workers stay parked instead of spinning on them.
+ */
+bool WorkerPool::HasRunnableJob() const
+{
+    for (size_t lane = 0; lane < JobPriorityCount; lane++)
+    {
+        const uint32_t limit = config.laneWorkerLimits[lane];
+        if (queuedPerLane[lane] > 0 && (limit == 0 || runningPerLane[lane] < static_cast<int>(limit)))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Busy-waits (or yields) for up to idleSpinDuration until a runnable job shows up.
+ * 
+ * Only reads the lane counters, so a spinning worker does not touch any queue lock. A spinning worker is
+ * not counted in sleepingWorkers, so producers skip the wake-up handshake entirely while it spins.
+ * The clock is only read every few iterations to keep the loop light.
+ * 
+ * @return true if a job may be available, false if the window expired (or a stop was requested)
+ */
+bool WorkerPool::SpinForJob(const std::stop_token& stopToken) const
+{
+    constexpr int IterationsPerClockCheck = 64;
+    const int64_t deadline = NowNanoseconds() + std::chrono::duration_cast<std::chrono::nanoseconds>(config.idleSpinDuration).count();
+
+    while (!stopToken.stop_requested())
+    {
+        for (int i = 0; i < IterationsPerClockCheck; i++)
+        {
+            if (HasRunnableJob())
+            {
+                return true;
+            }
+
+            if (config.idlePolicy == IdlePolicy::YieldThenPark)
+            {
+                std::this_thread::yield();
+            }
+            else
+            {
+                CpuRelax();
+            }
+        }
+
+        if (NowNanoseconds() >= deadline)
+        {
+            return false;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Removes finished (or discarded) jobs from the in-flight counter.
+ * 
+ * When the counter reaches zero, waiters of WaitForCompletion are woken. Taking completionMutex before
+ * notifying closes the window between a waiter's check of the counter and its wait.
+ */
+void WorkerPool::FinishJobs(int count)
+{
+    if (count > 0 && (inFlightJobs -= count) == 0)
+    {
+        {
+            std::scoped_lock lock(completionMutex);
+        }
+        completionCondition.notify_all();
+    }
+}
+
+/**
+ * @brief Wakes up to count parked workers, if any.
+ * 
+ * The pending counter is incremented before calling this method. A worker registers itself as sleeping
+ * under jobMutex before checking the counter, so taking that mutex here guarantees the notification
+ * cannot fall between the worker's check and its wait. When there are at least as many new jobs as
+ * sleeping workers, they are all woken with a single notify_all.
+ */
+void WorkerPool::WakeWorkers(int count)
+{
+    const int sleeping = sleepingWorkers;
+    if (sleeping == 0)
+    {
+        return;
+    }
+
+    {
+        std::scoped_lock lock(jobMutex);
+    }
+
+    if (count >= sleeping)
+    {
+        ConditionalVariable.notify_all();
+        return;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        ConditionalVariable.notify_one();
+    }
+}
+
+/**
+ * @brief Raises a high-water mark to value if it is higher (lock-free).
+ */
+void WorkerPool::UpdateHighWaterMark(std::atomic<int>& highWaterMark, int value)
+{
+    int current = highWaterMark.load(std::memory_order_relaxed);
+    while (value > current && !highWaterMark.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+/**
+ * @brief Updates the queue-depth and in-flight high-water marks after jobs were queued.
+ * 
+ * Each mark is only written when it is exceeded, so in steady state this is three relaxed loads.
+ */
+void WorkerPool::RecordQueued(JobPriority priority, int laneSize, int queueSize, int inFlight)
+{
+    UpdateHighWaterMark(queuedHighWaterMarks[static_cast<size_t>(priority)], laneSize);
+    UpdateHighWaterMark(queuedHighWaterMark, queueSize);
+    UpdateHighWaterMark(inFlightHighWaterMark, inFlight);
+}
+
+/**
+ * @brief Get the current time of the steady clock, in nanoseconds since its epoch.
+ */
+int64_t WorkerPool::NowNanoseconds()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief Checks whether records of a level pass the configured log level.
+ * 
+ * Callers test this before building a record, so a disabled level only costs this comparison.
+ */
+bool WorkerPool::ShouldLog(LogLevel level) const
+{
+    return level >= config.logLevel;
+}
+
+/**
+ * @brief Hands a record to the asynchronous log sink; it is formatted and printed by the sink's drain thread.
+ */
+void WorkerPool::Log(LogRecord record) const
+{
+    record.source = "WorkerPool";
+    LogSink::Write(record);
 }
@@ -1,11 +1,33 @@
 #pragma once
 
+#include "WorkerPoolConfig.h"
+#include "WorkStealingQueue.h"
+#include "RingBuffer.h"
+#include "JobQueue.h"
+#include "LatencyHistogram.h"
+#include "WorkerTelemetry.h"
+#include "WorkerContext.h"
+#include "WorkerPoolStats.h"
+#include "LogSink.h"
+#include "TaskHandle.h"
+#include "JobGroup.h"
+#include "TimerQueue.h"
+#include "CoTask.h"
+#include "Job.h"
+
 #include <condition_variable>
 #include <functional>
+#include <coroutine>
+#include <stop_token>
+#include <iterator>
+#include <optional>
+#include <deque>
+#include <array>
+#include <chrono>
 #include <thread>
 #include <vector>
 #include <atomic>
-#include <queue>
+#include <memory>
 #include <mutex>
 
 class WorkerPool
@@ -14,6 +36,7 @@ public:
 
     //////// CONSTRUCTOR ////////
     WorkerPool();
+    explicit WorkerPool(const WorkerPoolConfig& config);
     ~WorkerPool();
 
 	//////// DELETED METHODS ////////
@@ -25,32 +48,460 @@ public:
     void Start();
     void Stop();
     void WaitForCompletion() const;
+    bool WaitForCompletion(std::chrono::milliseconds timeout) const;
 
 	//// Jobs
-    void AddJob(std::function<void()> job);
+    template <typename F>
+    bool AddJob(F&& job, JobPriority priority = JobPriority::Normal);
+    template <typename Range>
+    size_t AddJobs(Range&& jobs, JobPriority priority = JobPriority::Normal);
+    template <typename F>
+    size_t AddJobs(size_t count, F&& jobFactory, JobPriority priority = JobPriority::Normal);
     void ClearAllJobs();
 
+    //// Groups
+    JobGroup CreateGroup();
+    template <typename F>
+    std::optional<uint64_t> AddJobToGroup(const JobGroup& group, F&& job, JobPriority priority = JobPriority::Normal);
+    template <typename F>
+    size_t AddJobsToGroup(const JobGroup& group, size_t count, F&& jobFactory, JobPriority priority = JobPriority::Normal);
+    void WaitForGroup(const JobGroup& group) const;
+    bool WaitForGroup(const JobGroup& group, std::chrono::milliseconds timeout) const;
+    size_t CancelGroup(const JobGroup& group);
+    bool CancelJob(uint64_t jobId);
+    [[nodiscard]] static std::stop_token GetStopToken();
+
+    //// Worker context
+    [[nodiscard]] static WorkerContext& GetContext();
+
+    //// Timers
+    template <typename F>
+    TimerId AddDelayedJob(std::chrono::nanoseconds delay, F&& job, JobPriority priority = JobPriority::Normal);
+    template <typename F>
+    TimerId AddPeriodicJob(std::chrono::nanoseconds period, F&& job, JobPriority priority = JobPriority::Normal);
+    bool CancelTimer(TimerId id);
+
+    //// Tasks
+    template <typename F>
+    auto Submit(F&& function, const std::vector<TaskDependency>& dependencies = {});
+
+    //// Coroutines
+    class ScheduleAwaiter;
+    class DelayAwaiter;
+    template <typename T>
+    TaskHandle<T> Spawn(CoTask<T> task, JobPriority priority = JobPriority::Normal);
+    [[nodiscard]] ScheduleAwaiter Schedule(JobPriority priority = JobPriority::Normal);
+    [[nodiscard]] DelayAwaiter Delay(std::chrono::nanoseconds duration);
+
     //// Helpers
     [[nodiscard]] bool IsRunning() const;
     [[nodiscard]] int GetPendingJobsCount() const;
+    [[nodiscard]] int GetInFlightJobsCount() const;
+    [[nodiscard]] int GetWorkerCount() const;
+    [[nodiscard]] SchedulerMode GetSchedulerMode() const;
+    [[nodiscard]] const WorkerPoolConfig& GetConfig() const;
+
+    //// Stats
+    [[nodiscard]] WorkerPoolStats GetStats() const;
+    [[nodiscard]] LatencySummary GetLaneLatency(JobPriority priority) const;
+    void PrintLaneLatencyReport() const;
 
 private:
 
 	//////// METHODS ////////
+    //// Jobs
+    std::optional<uint64_t> PushJob(Job&& job, bool canReject = true);
+    size_t PushJobs(std::vector<Job>& jobs, JobPriority priority);
+    bool HandleOverflow(Job& job, bool canReject);
+    void RunInline(Job& job);
+    bool RunJob(Job& job, std::stop_source& jobStopSource, const std::stop_token& workerStopToken);
+    void NotifyProducers();
+
+    //// Timers
+    TimerId AddTimer(int64_t dueTime, Job&& job);
+    TimerId AddPeriodicTimer(std::chrono::nanoseconds period, Job&& job);
+    TimerQueue& GetTimers();
+    void StopTimers();
+
+    //// Coroutines
+    template <typename T>
+    static DetachedCoroutine DriveTask(CoTask<T> task, std::shared_ptr<TaskState<T>> state);
+
+	//// Helpers
+    static int64_t NowNanoseconds();
+
 	//// Worker
     static void Work(std::stop_token stopToken, WorkerPool* self, int workerID);
-    void LogWorkerMessage(int jobId, int workerID, const std::string& message, bool silent = false) const;
+    bool TryGetJob(int workerID, Job& outJob, bool& outStolen);
+    bool TryPopLane(JobPriority priority, Job& outJob);
+    bool TryAcquireLane(JobPriority priority);
+    void ReleaseLane(JobPriority priority);
+    bool HasRunnableJob() const;
+    bool SpinForJob(const std::stop_token& stopToken) const;
+    void WakeWorkers(int count);
+    void FinishJobs(int count);
     void StopAllWorkers();
 
+    //// Elastic workers
+    void Supervise(std::stop_token stopToken);
+    void SpawnWorker(int queued, int blocked);
+    void RetireWorker(int workerID);
+    int CountBlockedWorkers(int64_t now) const;
+    void RecordScaling(ScalingAction action, int workerID, int workerCount, int queued, int blocked);
+
+    //// Telemetry
+    static void UpdateHighWaterMark(std::atomic<int>& highWaterMark, int value);
+    void RecordQueued(JobPriority priority, int laneSize, int queueSize, int inFlight);
+
+    //// Logging
+    bool ShouldLog(LogLevel level) const;
+    void Log(LogRecord record) const;
+
+    //////// FRIENDS ////////
+    friend class TaskStateBase;
+
     //////// FIELDS ////////
 	//// members
+    WorkerPoolConfig config;
     std::atomic<bool> isRunning{ false };
     std::vector<std::jthread> workersList;
-    std::atomic<int> nextJobId{ 0 };
-    bool silent = false;
+    std::atomic<uint64_t> nextJobId{ 0 };
+    std::atomic<int> queuedJobs{ 0 };
+    std::atomic<int> inFlightJobs{ 0 };
+    std::atomic<int> sleepingWorkers{ 0 };
+
+	//// elastic workers (slots below coreWorkerCount never retire)
+    uint32_t coreWorkerCount = 0;
+    uint32_t maxWorkerCount = 0;
+    std::vector<std::atomic<bool>> activeSlots;
+    std::atomic<int> activeWorkers{ 0 };
+    std::atomic<int> peakWorkers{ 0 };
+    std::atomic<uint64_t> spawnedWorkers{ 0 };
+    std::atomic<uint64_t> retiredWorkers{ 0 };
+    mutable std::mutex scalingMutex;
+    std::deque<ScalingEvent> scalingEvents;
+    std::mutex supervisorMutex;
+    std::condition_variable_any supervisorCondition;
+    std::jthread supervisor;
+
+	//// lanes
+    std::array<std::atomic<int>, JobPriorityCount> queuedPerLane{};
+    std::array<std::atomic<int>, JobPriorityCount> runningPerLane{};
+
+	//// telemetry
+    int64_t startTime = 0;
+    std::vector<std::unique_ptr<WorkerTelemetry>> workerTelemetry;
+    std::array<std::atomic<int>, JobPriorityCount> queuedHighWaterMarks{};
+    std::atomic<int> queuedHighWaterMark{ 0 };
+    std::atomic<int> inFlightHighWaterMark{ 0 };
+    std::atomic<uint64_t> rejectedJobs{ 0 };
+    std::atomic<uint64_t> ranInlineJobs{ 0 };
+    std::atomic<uint64_t> cancelledJobs{ 0 };
+
+	//// worker-local contexts (one per worker slot)
+    std::vector<std::unique_ptr<WorkerContext>> workerContexts;
+
+	//// work stealing
+    std::vector<std::unique_ptr<WorkStealingQueue<Job>>> localQueues;
 
 	//// static
     mutable std::mutex jobMutex;
-    std::queue<std::pair<std::function<void()>, int>> jobQueue;
-    std::condition_variable ConditionalVariable;
-};
\ No newline at end of file
+    std::array<std::unique_ptr<JobQueue>, JobPriorityCount> jobQueues;
+    std::condition_variable_any ConditionalVariable;
+
+	//// backpressure
+    std::mutex spaceMutex;
+    std::condition_variable spaceCondition;
+    std::atomic<int> waitingProducers{ 0 };
+
+	//// completion
+    mutable std::mutex completionMutex;
+    mutable std::condition_variable completionCondition;
+
+	//// groups
+    std::mutex groupsMutex;
+    std::vector<std::weak_ptr<JobGroupState>> groups;
+    std::atomic<int> nextGroupId{ 0 };
+
+	//// timers (created on first use)
+    std::once_flag timersCreation;
+    std::atomic<bool> hasTimers{ false };
+    std::unique_ptr<TimerQueue> timers;
+};
+
+/**
+ * @brief Awaitable returned by WorkerPool::Schedule: resumes the coroutine on a worker of the pool
+ */
+class WorkerPool::ScheduleAwaiter
+{
+public:
+
+    //////// CONSTRUCTOR ////////
+    ScheduleAwaiter(WorkerPool* pool, JobPriority priority) : pool(pool), priority(priority) {}
+
+	//////// METHODS ////////
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> handle) const;
+    void await_resume() const noexcept {}
+
+private:
+
+    //////// FIELDS ////////
+    WorkerPool* pool;
+    JobPriority priority;
+};
+
+/**
+ * @brief Awaitable returned by WorkerPool::Delay: resumes the coroutine on a worker once the delay has elapsed
+ */
+class WorkerPool::DelayAwaiter
+{
+public:
+
+    //////// CONSTRUCTOR ////////
+    DelayAwaiter(WorkerPool* pool, std::chrono::nanoseconds duration) : pool(pool), duration(duration) {}
+
+	//////// METHODS ////////
+    bool await_ready() const noexcept { return duration.count() <= 0; }
+    void await_suspend(std::coroutine_handle<> handle) const;
+    void await_resume() const noexcept {}
+
+private:
+
+    //////// FIELDS ////////
+    WorkerPool* pool;
+    std::chrono::nanoseconds duration;
+};
+
+/**
+ * @brief Adds a new job to the worker pool.
+ * 
+ * The callable is moved (or copied, for lvalues) once into a move-only Job; small captures are
+ * stored inline, larger ones in recycled storage, and the Job is only moved afterwards.
+ * 
+ * @return false only if the lane queue is full and the overflow policy is Reject (the job is dropped)
+ */
+template <typename F>
+bool WorkerPool::AddJob(F&& job, JobPriority priority)
+{
+    Job queuedJob(std::forward<F>(job));
+    queuedJob.SetPriority(priority);
+    return PushJob(std::move(queuedJob)).has_value();
+}
+
+/**
+ * @brief Adds a whole range of jobs to the worker pool at once.
+ * 
+ * Every element of the range must be callable with no argument. The jobs are queued with a single
+ * lock acquisition per destination queue and the right number of sleeping workers is woken in one go.
+ * Pass an rvalue std::vector<Job> to hand over already-built jobs without any extra move.
+ * 
+ * @return Number of jobs accepted (lower than the range size only with the Reject overflow policy)
+ */
+template <typename Range>
+size_t WorkerPool::AddJobs(Range&& jobs, JobPriority priority)
+{
+    if constexpr (std::is_same_v<std::decay_t<Range>, std::vector<Job>> && std::is_rvalue_reference_v<Range&&>)
+    {
+        return PushJobs(jobs, priority);
+    }
+    else
+    {
+        std::vector<Job> batch;
+        batch.reserve(std::size(jobs));
+        for (auto&& job : jobs)
+        {
+            if constexpr (std::is_rvalue_reference_v<Range&&>)
+            {
+                batch.emplace_back(std::move(job));
+            }
+            else
+            {
+                batch.emplace_back(job);
+            }
+        }
+        return PushJobs(batch, priority);
+    }
+}
+
+/**
+ * @brief Adds count jobs built by jobFactory(index) to the worker pool at once.
+ * 
+ * Convenient for fan-outs: pool.AddJobs(10000, [&](size_t i) { return [&, i]() { Process(i); }; });
+ */
+template <typename F>
+size_t WorkerPool::AddJobs(size_t count, F&& jobFactory, JobPriority priority)
+{
+    std::vector<Job> batch;
+    batch.reserve(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        batch.emplace_back(jobFactory(i));
+    }
+    return PushJobs(batch, priority);
+}
+
+/**
+ * @brief Adds a job to a group (see CreateGroup).
+ * 
+ * The job can then be waited for with WaitForGroup and cancelled with CancelGroup or CancelJob. While it runs,
+ * WorkerPool::GetStopToken() returns a token that is stopped by either cancellation (or by Stop).
+ * 
+ * @return ID of the job, to pass to CancelJob, or no value if it was rejected by a full queue
+ */
+template <typename F>
+std::optional<uint64_t> WorkerPool::AddJobToGroup(const JobGroup& group, F&& job, JobPriority priority)
+{
+    Job queuedJob(std::forward<F>(job));
+    queuedJob.SetPriority(priority);
+    queuedJob.SetGroup(group.state);
+    return PushJob(std::move(queuedJob));
+}
+
+/**
+ * @brief Adds count jobs built by jobFactory(index) to a group at once.
+ * 
+ * Cancellable fan-out: the jobs get consecutive IDs and a cancelled group stops running them as soon as
+ * workers pop them.
+ * 
+ * @return Number of jobs accepted
+ */
+template <typename F>
+size_t WorkerPool::AddJobsToGroup(const JobGroup& group, size_t count, F&& jobFactory, JobPriority priority)
+{
+    std::vector<Job> batch;
+    batch.reserve(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        batch.emplace_back(jobFactory(i));
+        batch.back().SetGroup(group.state);
+    }
+    return PushJobs(batch, priority);
+}
+
+/**
+ * @brief Runs a job once, after a delay.
+ * 
+ * The job waits in the timer wheel (no worker is held) and is then queued in its lane like any other job.
+ * It counts as in flight from now on, so WaitForCompletion waits for it. Timers have a 1 ms resolution.
+ * 
+ * @return ID to pass to CancelTimer
+ */
+template <typename F>
+TimerId WorkerPool::AddDelayedJob(std::chrono::nanoseconds delay, F&& job, JobPriority priority)
+{
+    Job delayedJob(std::forward<F>(job));
+    delayedJob.SetPriority(priority);
+    return AddTimer(NowNanoseconds() + delay.count(), std::move(delayedJob));
+}
+
+/**
+ * @brief Runs a job every period (first run one period from now) until the timer is cancelled.
+ * 
+ * Runs are scheduled from the previous deadline, so they do not drift. A run is skipped if the previous one is
+ * still executing, so the job never runs concurrently with itself. Periodic timers are not counted by
+ * WaitForCompletion (only their queued runs are).
+ * 
+ * @return ID to pass to CancelTimer
+ */
+template <typename F>
+TimerId WorkerPool::AddPeriodicJob(std::chrono::nanoseconds period, F&& job, JobPriority priority)
+{
+    Job periodicJob(std::forward<F>(job));
+    periodicJob.SetPriority(priority);
+    return AddPeriodicTimer(period, std::move(periodicJob));
+}
+
+/**
+ * @brief Submits a job that produces a value and returns a handle to it.
+ *
+ * The job is queued the moment its last dependency completes (immediately if it has none);
+ * no worker ever blocks waiting on a dependency. Dependencies only order execution:
+ * read their results through their own handles (Get() is non-blocking by then).
+ */
+template <typename F>
+auto WorkerPool::Submit(F&& function, const std::vector<TaskDependency>& dependencies)
+{
+    using Result = std::invoke_result_t<std::decay_t<F>>;
+
+    auto state = std::make_shared<TaskState<Result>>(this);
+    TaskStateBase::ScheduleAfter(this, dependencies, [state, function = std::forward<F>(function)]() mutable
+    {
+        state->Run(function);
+    });
+
+    return TaskHandle<Result>(state);
+}
+
+/**
+ * @brief Starts a coroutine on the pool and returns a handle to its result.
+ *
+ * The coroutine's first resumption is queued as a job; from then on it only holds a worker while it runs,
+ * and gets resumed by a job again after each suspension (Schedule, Delay, awaited task handles).
+ * WaitForCompletion covers spawned coroutines, including those waiting on a Delay.
+ */
+template <typename T>
+TaskHandle<T> WorkerPool::Spawn(CoTask<T> task, JobPriority priority)
+{
+    auto state = std::make_shared<TaskState<T>>(this);
+    DetachedCoroutine driver = DriveTask(std::move(task), state);
+
+    Job start([handle = driver.GetHandle()]() { handle.resume(); });
+    start.SetPriority(priority);
+    PushJob(std::move(start), false);
+
+    return TaskHandle<T>(state);
+}
+
+/**
+ * @brief Runs a spawned coroutine to completion and stores its result (or exception) in its task state.
+ */
+template <typename T>
+DetachedCoroutine WorkerPool::DriveTask(CoTask<T> task, std::shared_ptr<TaskState<T>> state)
+{
+    std::exception_ptr exception;
+
+    if constexpr (std::is_void_v<T>)
+    {
+        try
+        {
+            co_await std::move(task);
+        }
+        catch (...)
+        {
+            exception = std::current_exception();
+        }
+
+        if (exception)
+        {
+            state->Fail(exception);
+        }
+        else
+        {
+            auto complete = []() {};
+            state->Run(complete);
+        }
+    }
+    else
+    {
+        std::optional<T> result;
+        try
+        {
+            result.emplace(co_await std::move(task));
+        }
+        catch (...)
+        {
+            exception = std::current_exception();
+        }
+
+        if (exception)
+        {
+            state->Fail(exception);
+        }
+        else
+        {
+            auto complete = [&result]() -> T { return std::move(*result); };
+            state->Run(complete);
+        }
+    }
+}
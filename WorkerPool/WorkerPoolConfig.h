@@ -0,0 +1,125 @@
+#pragma once
+
+#include "LogSink.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <chrono>
+#include <vector>
+#include <array>
+
+/**
+ * @brief Selects how jobs are distributed between the workers of a WorkerPool
+ *
+ * SharedQueue keeps a single mutex-guarded FIFO that every worker pops from.
+ * WorkStealing gives each worker its own deque: jobs submitted from a worker
+ * are pushed and popped locally, jobs submitted from outside the pool go through
+ * the injection queue, and idle workers steal from the others.
+ */
+enum class SchedulerMode : uint8_t
+{
+    SharedQueue,
+    WorkStealing
+};
+
+/**
+ * @brief Priority lane of a job
+ *
+ * Workers always take High jobs first, then Normal ones, and Low jobs only when
+ * nothing else is queued (and the Low lane is under its worker limit).
+ */
+enum class JobPriority : uint8_t
+{
+    High,
+    Normal,
+    Low
+};
+
+constexpr size_t JobPriorityCount = 3;
+
+/**
+ * @brief Implementation of the shared queue of each priority lane
+ *
+ * Mutex is an unbounded FIFO behind a lock. BoundedLockFree is a fixed-capacity
+ * lock-free ring: memory stays bounded under producer bursts, and a full queue
+ * triggers the pool's OverflowPolicy.
+ */
+enum class QueueBackend : uint8_t
+{
+    Mutex,
+    BoundedLockFree
+};
+
+/**
+ * @brief What a submission does when a bounded lane queue is full
+ *
+ * Block waits for room, Reject drops the job and makes AddJob return false,
+ * RunInline runs the job on the submitting thread. A worker of the pool never
+ * blocks on its own pool: Block falls back to RunInline there.
+ */
+enum class OverflowPolicy : uint8_t
+{
+    Block,
+    Reject,
+    RunInline
+};
+
+/**
+ * @brief What a worker does when it runs out of jobs
+ *
+ * Park sleeps on the condition variable right away: no CPU is burnt, but the next job pays
+ * for a full OS wake-up. SpinThenPark busy-waits (with a CPU pause hint) and YieldThenPark
+ * yields its time slice for idleSpinDuration first, so a job arriving within that window is
+ * picked up without any wake-up, at the cost of keeping the core busy meanwhile.
+ */
+enum class IdlePolicy : uint8_t
+{
+    Park,
+    SpinThenPark,
+    YieldThenPark
+};
+
+/**
+ * @brief Construction parameters of a WorkerPool
+ */
+struct WorkerPoolConfig
+{
+    SchedulerMode schedulerMode = SchedulerMode::WorkStealing;
+
+    //// Number of worker threads (0 = hardware_concurrency() - 1, at least one)
+    uint32_t workerCount = 0;
+
+    //// CPUs the workers are pinned to: worker i runs on workerAffinity[i % size] (empty = no pinning)
+    std::vector<int> workerAffinity;
+
+    //// Idle strategy and how long a worker spins or yields before parking
+    IdlePolicy idlePolicy = IdlePolicy::Park;
+    std::chrono::microseconds idleSpinDuration{ 50 };
+
+    //// Elastic mode, enabled when maxWorkerCount > workerCount (workerCount is then the minimum).
+    //// An extra worker is spawned when jobs stay queued for scaleUpDelay while no worker is parked
+    //// and at least one has been stuck on the same job for blockedThreshold (sleep, I/O...).
+    //// Extra workers retire after idling for retireDelay.
+    uint32_t maxWorkerCount = 0;
+    std::chrono::milliseconds scaleUpDelay{ 50 };
+    std::chrono::milliseconds blockedThreshold{ 20 };
+    std::chrono::milliseconds retireDelay{ 2000 };
+
+    //// Worker-local context (WorkerPool::GetContext): seed of the per-worker random engines
+    //// (mixed with the worker ID) and initial size of each worker's scratch arena
+    uint64_t randomSeed = 0;
+    size_t scratchArenaSize = 64 * 1024;
+
+    //// Maximum number of workers running jobs of each lane at once (0 = no limit),
+    //// e.g. { 0, 0, 2 } never lets Low jobs occupy more than two workers.
+    std::array<uint32_t, JobPriorityCount> laneWorkerLimits = { 0, 0, 0 };
+
+    //// Shared lane queues; capacity and overflow policy only apply to BoundedLockFree
+    QueueBackend queueBackend = QueueBackend::Mutex;
+    size_t queueCapacity = 4096;
+    OverflowPolicy overflowPolicy = OverflowPolicy::Block;
+
+    //// Records below this level are skipped before being built: Info reports start and stop,
+    //// Debug every job event, Off nothing at all
+    LogLevel logLevel = LogLevel::Info;
+};
@@ -0,0 +1,67 @@
+#include "WorkerPoolStats.h"
+
+#include <sstream>
+
+namespace
+{
+    const char* const LaneNames[JobPriorityCount] = { "High", "Normal", "Low" };
+
+    void WriteLatency(std::ostringstream& json, const char* name, const LatencySummary& summary)
+    {
+        json << "\"" << name << "\": { \"count\": " << summary.count << ", \"p50\": " << summary.p50 << ", \"p90\": " << summary.p90
+             << ", \"p99\": " << summary.p99 << ", \"max\": " << summary.max << " }";
+    }
+}
+
+/**
+ * @brief Serializes the snapshot as a JSON object.
+ *
+ * Durations are in nanoseconds; lanes are listed from High to Low and workers by ID.
+ */
+std::string WorkerPoolStats::ToJson() const
+{
+    std::ostringstream json;
+    json << "{\n";
+    json << "  \"uptimeNs\": " << uptimeNanoseconds << ",\n";
+    json << "  \"jobs\": { \"submitted\": " << jobsSubmitted << ", \"rejected\": " << jobsRejected << ", \"ranInline\": " << jobsRanInline
+         << ", \"cancelled\": " << jobsCancelled << ", \"storageHeapAllocations\": " << jobStorageHeapAllocations << ", \"queued\": " << queuedJobs << ", \"queuedHighWaterMark\": " << queuedHighWaterMark
+         << ", \"inFlight\": " << inFlightJobs << ", \"inFlightHighWaterMark\": " << inFlightHighWaterMark << " },\n";
+
+    json << "  \"lanes\": [\n";
+    for (size_t lane = 0; lane < JobPriorityCount; lane++)
+    {
+        const LaneStats& stats = lanes[lane];
+        json << "    { \"name\": \"" << LaneNames[lane] << "\", \"queued\": " << stats.queued << ", \"queuedHighWaterMark\": " << stats.queuedHighWaterMark
+             << ", \"running\": " << stats.running << ", ";
+        WriteLatency(json, "queueWaitNs", stats.queueWait);
+        json << ", ";
+        WriteLatency(json, "executionNs", stats.execution);
+        json << " }" << (lane + 1 < JobPriorityCount ? "," : "") << "\n";
+    }
+    json << "  ],\n";
+
+    json << "  \"workers\": [\n";
+    for (size_t i = 0; i < workers.size(); i++)
+    {
+        const WorkerStats& worker = workers[i];
+        json << "    { \"id\": " << worker.workerID << ", \"active\": " << (worker.active ? "true" : "false") << ", \"jobsExecuted\": " << worker.jobsExecuted << ", \"jobsStolen\": " << worker.jobsStolen
+             << ", \"parkCount\": " << worker.parkCount << ", \"busyNs\": " << worker.busyNanoseconds << ", \"idleNs\": " << worker.idleNanoseconds
+             << " }" << (i + 1 < workers.size() ? "," : "") << "\n";
+    }
+    json << "  ],\n";
+
+    json << "  \"scaling\": { \"minWorkers\": " << scaling.minWorkers << ", \"maxWorkers\": " << scaling.maxWorkers
+         << ", \"activeWorkers\": " << scaling.activeWorkers << ", \"peakWorkers\": " << scaling.peakWorkers
+         << ", \"spawned\": " << scaling.workersSpawned << ", \"retired\": " << scaling.workersRetired << ", \"events\": [\n";
+    for (size_t i = 0; i < scaling.recentEvents.size(); i++)
+    {
+        const ScalingEvent& event = scaling.recentEvents[i];
+        json << "    { \"timeNs\": " << event.timeNanoseconds << ", \"action\": \"" << (event.action == ScalingAction::Spawned ? "spawned" : "retired")
+             << "\", \"workerId\": " << event.workerID << ", \"workers\": " << event.workerCount << ", \"queued\": " << event.queuedJobs
+             << ", \"blocked\": " << event.blockedWorkers << " }" << (i + 1 < scaling.recentEvents.size() ? "," : "") << "\n";
+    }
+    json << "  ] }\n";
+    json << "}\n";
+
+    return json.str();
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "WorkerPoolConfig.h"
+#include "LatencyHistogram.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <array>
+
+/**
+ * @brief Activity of one worker since the pool started
+ *
+ * Busy time is spent running jobs, idle time parked waiting for one; the rest of the
+ * uptime went into looking for jobs (pops, steal attempts) and scheduling overhead.
+ */
+struct WorkerStats
+{
+    int workerID = 0;
+    bool active = true;
+    uint64_t jobsExecuted = 0;
+    uint64_t jobsStolen = 0;
+    uint64_t parkCount = 0;
+    uint64_t busyNanoseconds = 0;
+    uint64_t idleNanoseconds = 0;
+};
+
+/**
+ * @brief State and latency distributions of one priority lane
+ *
+ * Queue wait is the time from submission to the start of the job, execution the time
+ * spent running it. A queue wait far above the execution time of the same lane points
+ * to head-of-line blocking or too few workers.
+ */
+struct LaneStats
+{
+    int queued = 0;
+    int queuedHighWaterMark = 0;
+    int running = 0;
+    LatencySummary queueWait;
+    LatencySummary execution;
+};
+
+/**
+ * @brief Direction of an elastic scaling decision
+ */
+enum class ScalingAction : uint8_t
+{
+    Spawned,
+    Retired
+};
+
+/**
+ * @brief One elastic scaling decision, with the pool state that triggered it
+ */
+struct ScalingEvent
+{
+    uint64_t timeNanoseconds = 0;
+    ScalingAction action = ScalingAction::Spawned;
+    int workerID = 0;
+    int workerCount = 0;
+    int queuedJobs = 0;
+    int blockedWorkers = 0;
+};
+
+/**
+ * @brief Worker count bounds and recent decisions of an elastic pool
+ *
+ * A fixed-size pool has minWorkers == maxWorkers and no event. Event times are relative
+ * to the start of the pool; only the most recent events are kept.
+ */
+struct ScalingStats
+{
+    uint32_t minWorkers = 0;
+    uint32_t maxWorkers = 0;
+    int activeWorkers = 0;
+    int peakWorkers = 0;
+    uint64_t workersSpawned = 0;
+    uint64_t workersRetired = 0;
+    std::vector<ScalingEvent> recentEvents;
+};
+
+/**
+ * @brief Point-in-time snapshot of a WorkerPool's telemetry (see WorkerPool::GetStats)
+ *
+ * Every counter is read without stopping the workers, so the values are individually
+ * consistent but may be a few jobs apart from each other. jobStorageHeapAllocations is
+ * process-wide (JobStorage is shared by every pool): compare two snapshots to check that
+ * a warm workload does not allocate job storage.
+ */
+struct WorkerPoolStats
+{
+    uint64_t uptimeNanoseconds = 0;
+    uint64_t jobsSubmitted = 0;
+    uint64_t jobsRejected = 0;
+    uint64_t jobsRanInline = 0;
+    uint64_t jobsCancelled = 0;
+    uint64_t jobStorageHeapAllocations = 0;
+    int queuedJobs = 0;
+    int queuedHighWaterMark = 0;
+    int inFlightJobs = 0;
+    int inFlightHighWaterMark = 0;
+    std::array<LaneStats, JobPriorityCount> lanes;
+    std::vector<WorkerStats> workers;
+    ScalingStats scaling;
+
+	//////// METHODS ////////
+    [[nodiscard]] std::string ToJson() const;
+};
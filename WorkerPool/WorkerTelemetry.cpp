@@ -0,0 +1,107 @@
+#include "WorkerTelemetry.h"
+
+/**
+ * @brief Records a job run by the owning worker.
+ */
+void WorkerTelemetry::RecordJob(JobPriority priority, uint64_t queueWaitNanoseconds, uint64_t executionNanoseconds, bool stolen)
+{
+    const size_t lane = static_cast<size_t>(priority);
+    queueWait[lane].Record(queueWaitNanoseconds);
+    execution[lane].Record(executionNanoseconds);
+
+    Add(jobsExecuted, 1);
+    Add(busyNanoseconds, executionNanoseconds);
+    if (stolen)
+    {
+        Add(jobsStolen, 1);
+    }
+}
+
+/**
+ * @brief Marks the owning worker as parked since now.
+ */
+void WorkerTelemetry::BeginPark(int64_t now)
+{
+    Add(parkCount, 1);
+    parkStartTime.store(now, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Adds the time spent parked since BeginPark to the idle time.
+ */
+void WorkerTelemetry::EndPark(int64_t now)
+{
+    Add(idleNanoseconds, static_cast<uint64_t>(now - parkStartTime.load(std::memory_order_relaxed)));
+    parkStartTime.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Marks the start of a job, so other threads can see how long the worker has been on it.
+ */
+void WorkerTelemetry::BeginJob(int64_t now)
+{
+    jobStartTime.store(now, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Marks the end of the current job.
+ */
+void WorkerTelemetry::EndJob()
+{
+    jobStartTime.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Get the queue-wait histogram of a lane (time from submission to start).
+ */
+const LatencyHistogram& WorkerTelemetry::GetQueueWait(JobPriority priority) const
+{
+    return queueWait[static_cast<size_t>(priority)];
+}
+
+/**
+ * @brief Get the execution-time histogram of a lane.
+ */
+const LatencyHistogram& WorkerTelemetry::GetExecution(JobPriority priority) const
+{
+    return execution[static_cast<size_t>(priority)];
+}
+
+/**
+ * @brief Get the counters of the owning worker.
+ * 
+ * If the worker is parked right now, the ongoing park counts as idle time up to now.
+ */
+WorkerStats WorkerTelemetry::GetStats(int workerID, int64_t now) const
+{
+    WorkerStats stats;
+    stats.workerID = workerID;
+    stats.jobsExecuted = jobsExecuted.load(std::memory_order_relaxed);
+    stats.jobsStolen = jobsStolen.load(std::memory_order_relaxed);
+    stats.parkCount = parkCount.load(std::memory_order_relaxed);
+    stats.busyNanoseconds = busyNanoseconds.load(std::memory_order_relaxed);
+    stats.idleNanoseconds = idleNanoseconds.load(std::memory_order_relaxed);
+
+    const int64_t parkStart = parkStartTime.load(std::memory_order_relaxed);
+    if (parkStart != 0 && now > parkStart)
+    {
+        stats.idleNanoseconds += static_cast<uint64_t>(now - parkStart);
+    }
+    return stats;
+}
+
+/**
+ * @brief Get the start time of the job the worker is running, 0 if it is not running one.
+ */
+int64_t WorkerTelemetry::GetJobStartTime() const
+{
+    return jobStartTime.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Adds to a counter that only the owning worker writes.
+ */
+void WorkerTelemetry::Add(std::atomic<uint64_t>& counter, uint64_t value)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "WorkerPoolConfig.h"
+#include "LatencyHistogram.h"
+#include "WorkerPoolStats.h"
+
+#include <atomic>
+#include <cstdint>
+#include <array>
+
+/**
+ * @brief Telemetry recorded by one worker
+ *
+ * Only the owning worker writes, with relaxed load/store pairs (no read-modify-write),
+ * and the object sits on its own cache lines, so recording never contends with other
+ * workers. Any thread may read it at any time to build a WorkerPoolStats snapshot.
+ */
+class alignas(64) WorkerTelemetry
+{
+public:
+
+    //////// CONSTRUCTOR ////////
+    WorkerTelemetry() = default;
+
+	//////// DELETED METHODS ////////
+    WorkerTelemetry(const WorkerTelemetry&) = delete;
+    WorkerTelemetry& operator=(const WorkerTelemetry&) = delete;
+
+	//////// METHODS ////////
+    //// Writer
+    void RecordJob(JobPriority priority, uint64_t queueWaitNanoseconds, uint64_t executionNanoseconds, bool stolen);
+    void BeginPark(int64_t now);
+    void EndPark(int64_t now);
+    void BeginJob(int64_t now);
+    void EndJob();
+
+    //// Readers
+    [[nodiscard]] const LatencyHistogram& GetQueueWait(JobPriority priority) const;
+    [[nodiscard]] const LatencyHistogram& GetExecution(JobPriority priority) const;
+    [[nodiscard]] WorkerStats GetStats(int workerID, int64_t now) const;
+    [[nodiscard]] int64_t GetJobStartTime() const;
+
+private:
+
+	//////// STATIC METHODS ////////
+    static void Add(std::atomic<uint64_t>& counter, uint64_t value);
+
+    //////// FIELDS ////////
+    std::array<LatencyHistogram, JobPriorityCount> queueWait;
+    std::array<LatencyHistogram, JobPriorityCount> execution;
+    std::atomic<uint64_t> jobsExecuted{ 0 };
+    std::atomic<uint64_t> jobsStolen{ 0 };
+    std::atomic<uint64_t> parkCount{ 0 };
+    std::atomic<uint64_t> busyNanoseconds{ 0 };
+    std::atomic<uint64_t> idleNanoseconds{ 0 };
+    std::atomic<int64_t> parkStartTime{ 0 };
+    std::atomic<int64_t> jobStartTime{ 0 };
+};